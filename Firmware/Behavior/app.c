@@ -89,7 +89,6 @@ void core_callback_catastrophic_error_detected(void)
 /************************************************************************/
 /* General definitions                                                  */
 /************************************************************************/
-countdown_t pulse_countdown;
 
 /************************************************************************/
 /* General used functions                                               */
@@ -249,6 +248,91 @@ void core_callback_reset_registers(void)
     app_regs.REG_MOTOR_OUT3_PULSE = 1500;
 	
 	app_regs.REG_POKE_INPUT_FILTER_MS = 1;
+	
+	app_regs.REG_PROFILER_CTRL = 0;
+	app_regs.REG_CPU_LOAD[0] = CPU_LOAD_UNKNOWN;
+	app_regs.REG_CPU_LOAD[1] = CPU_LOAD_UNKNOWN;
+	
+	app_regs.REG_PULSE_HIGH_RES = 0;
+	
+	for (uint8_t i = 0; i < TRAIN_CHANNELS; i++)
+	{
+		app_regs.REG_TRAIN_WIDTH[i] = 10;
+		app_regs.REG_TRAIN_PERIOD[i] = 100;
+		app_regs.REG_TRAIN_COUNT[i] = 10;
+	}
+	app_regs.REG_TRAIN_START = 0;
+	app_regs.REG_TRAIN_STOP = 0;
+	app_regs.REG_TRAIN_DONE = 0;
+	
+	for (uint8_t i = 0; i < SCHEDULE_UPLOAD_ENTRIES * SCHEDULE_ENTRY_WORDS; i++)
+		app_regs.REG_SCHEDULE_ADD[i] = 0;
+	app_regs.REG_SCHEDULE_DEPTH = 0;
+	app_regs.REG_SCHEDULE_FLUSH = 0;
+	app_regs.REG_SCHEDULE_DONE[0] = 0;
+	app_regs.REG_SCHEDULE_DONE[1] = 0;
+	
+	for (uint8_t i = 0; i < sizeof(app_regs.REG_TRANSACTION); i++)
+		app_regs.REG_TRANSACTION[i] = 0;
+	
+	for (uint8_t i = 0; i < 5; i++)
+		app_regs.REG_START_AT[i] = 0;
+	
+	app_regs.REG_PWM_START_SYNC = 0;
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_PWM_PHASE[i] = 0;
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		app_regs.REG_CHIRP_FREQ_START[i] = 1000;
+		app_regs.REG_CHIRP_FREQ_END[i] = 2000;
+		app_regs.REG_CHIRP_DURATION[i] = 1000;
+		app_regs.REG_CHIRP_SHAPE[i] = GM_CHIRP_LINEAR;
+	}
+	app_regs.REG_CHIRP_START = 0;
+	
+	for (uint8_t i = 0; i <= WAVEFORM_UPLOAD_SAMPLES; i++)
+		app_regs.REG_WAVEFORM_DATA[i] = 0;
+	app_regs.REG_WAVEFORM_LENGTH = WAVEFORM_CAPACITY;
+	app_regs.REG_WAVEFORM_RATE = 1000;
+	app_regs.REG_WAVEFORM_REPEAT = 1;
+	app_regs.REG_WAVEFORM_TRIGGER = 0;
+	app_regs.REG_WAVEFORM_START = 0;
+	app_regs.REG_WAVEFORM_STOP = 0;
+	app_regs.REG_WAVEFORM_DONE = 0;
+	
+	app_regs.REG_PWM_FREQ_FINE[0] = 1000000;
+	app_regs.REG_PWM_FREQ_FINE[1] = 2000000;
+	app_regs.REG_PWM_FREQ_FINE[2] = 3000000;
+	app_regs.REG_PWM_FREQ_FINE[3] = 4000000;
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_PWM_DCYCLE_FINE[i] = 5000;
+	
+	app_regs.REG_POKE_CAPTURE = B_DI0 | B_DI1 | B_DI2;
+	
+	/* REG_POKE_INPUT_FILTER_MS's 1 ms on the pokes */
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		app_regs.REG_DI_DEBOUNCE_RISE[i] = 1000;
+		app_regs.REG_DI_DEBOUNCE_FALL[i] = 1000;
+	}
+	app_regs.REG_DI_DEBOUNCE_RISE[3] = 0;
+	app_regs.REG_DI_DEBOUNCE_FALL[3] = 0;
+	
+	for (uint8_t i = 0; i < 8; i++)
+		app_regs.REG_EDGE_FIFO[i] = 0;
+	app_regs.REG_EDGE_FIFO_EN = 0;
+	
+	app_regs.REG_EDGE_COUNT_RISING = 0;
+	app_regs.REG_EDGE_COUNT_FALLING = 0;
+	app_regs.REG_EDGE_COUNT_WINDOW = 1000;
+	for (uint8_t i = 0; i < 12; i++)
+		app_regs.REG_EDGE_COUNTS[i] = 0;
+	
+	app_regs.REG_MIMIC_HW = 0;
+	app_regs.REG_MIMIC_HW_ROUTED = 0;
+	
+	app_regs.REG_EVNT_ENABLE_EXT = 0;
 }
 
 extern ports_state_t _states_;
@@ -282,6 +366,16 @@ void core_callback_registers_were_reinitialized(void)
     aux8b = app_regs.REG_LED1_CURRENT;
     app_write_REG_LED1_CURRENT(&aux8b);
     
+    /* The frequencies use the duty cycles */
+    aux8b = app_regs.REG_DCYCLE_DO0;
+    app_write_REG_DCYCLE_DO0(&aux8b);
+    aux8b = app_regs.REG_DCYCLE_DO1;
+    app_write_REG_DCYCLE_DO1(&aux8b);
+    aux8b = app_regs.REG_DCYCLE_DO2;
+    app_write_REG_DCYCLE_DO2(&aux8b);
+    aux8b = app_regs.REG_DCYCLE_DO3;
+    app_write_REG_DCYCLE_DO3(&aux8b);
+    
     aux16b = app_regs.REG_FREQ_DO0;
     app_write_REG_FREQ_DO0(&aux16b);
     aux16b = app_regs.REG_FREQ_DO1;
@@ -312,6 +406,29 @@ void core_callback_registers_were_reinitialized(void)
     app_write_REG_MIMIC_PORT2_VALVE(&aux8b);
 	
 	app_regs.REG_POKE_INPUT_FILTER_MS = 1;	
+	
+	aux8b = app_regs.REG_PROFILER_CTRL;
+	app_write_REG_PROFILER_CTRL(&aux8b);
+	
+	aux8b = app_regs.REG_POKE_CAPTURE;
+	app_write_REG_POKE_CAPTURE(&aux8b);
+	
+	aux16b = app_regs.REG_PULSE_HIGH_RES;
+	app_write_REG_PULSE_HIGH_RES(&aux16b);
+	
+	/* A counting window starts */
+	aux8b = app_regs.REG_EDGE_COUNT_RISING;
+	app_write_REG_EDGE_COUNT_RISING(&aux8b);
+	
+	aux8b = app_regs.REG_MIMIC_HW;
+	app_write_REG_MIMIC_HW(&aux8b);
+	
+	/* Operations scheduled before the registers changed are dropped */
+	aux8b = app_regs.REG_SCHEDULE_FLUSH;
+	app_write_REG_SCHEDULE_FLUSH(&aux8b);
+	
+	/* The LED currents go back to REG_LEDx_CURRENT */
+	waveform_stop(WAVEFORM_MASK);
 }
 
 /************************************************************************/
@@ -410,113 +527,113 @@ void core_callback_t_new_second(void)
 	/* Xmit current timestamp through serial */
 	timestamp_tx_streaming();
 	
+	cpu_load_update();
+	
    t1ms = 0;
 }
 
+void pulse_expire(uint8_t channel)
+{
+	if (pulse_train_step(channel))
+		return;
+	
+	switch (channel)
+	{
+		case PULSE_POKE0_LED: clr_POKE0_LED; break;
+		case PULSE_POKE1_LED: clr_POKE1_LED; break;
+		case PULSE_POKE2_LED: clr_POKE2_LED; break;
+		
+		case PULSE_POKE0_VALVE: clr_POKE0_VALVE; break;
+		case PULSE_POKE1_VALVE: clr_POKE1_VALVE; break;
+		case PULSE_POKE2_VALVE: clr_POKE2_VALVE; break;
+		
+		case PULSE_LED0: clr_LED0; break;
+		case PULSE_LED1: clr_LED1; break;
+		
+		case PULSE_RGB0: rgb0_on = false; break;
+		case PULSE_RGB1: rgb1_on = false; break;
+		
+		case PULSE_DO0:
+			clr_DO0;
+			if (_states_.pwm.do0)
+			{
+				_states_.pwm.do0 = false;
+				timer_type0_stop(&TCF0);
+			}
+			break;
+		case PULSE_DO1:
+			clr_DO1;
+			if (_states_.pwm.do1)
+			{
+				_states_.pwm.do1 = false;
+				timer_type0_stop(&TCE0);
+			}
+			break;
+		case PULSE_DO2:
+			clr_DO2;
+			if (_states_.pwm.do2)
+			{
+				_states_.pwm.do2 = false;
+				timer_type0_stop(&TCD0);
+			}
+			break;
+		case PULSE_DO3:
+			clr_DO3;
+			if (_states_.pwm.do3)
+			{
+				_states_.pwm.do3 = false;
+				timer_type0_stop(&TCC0);
+			}
+			break;
+	}
+}
+
 void core_callback_t_500us(void)
 {
-	bool prev_rgb0_on, prev_rgb1_on;
-	prev_rgb0_on = rgb0_on;
-	prev_rgb1_on = rgb1_on;
-
-	if (pulse_countdown.poke0_led > 0)
-		if (--pulse_countdown.poke0_led == 0)
-			clr_POKE0_LED;
-	if (pulse_countdown.poke1_led > 0)
-		if (--pulse_countdown.poke1_led == 0)
-			clr_POKE1_LED;
-	if (pulse_countdown.poke2_led > 0)
-		if (--pulse_countdown.poke2_led == 0)
-			clr_POKE2_LED;
-
-	if (pulse_countdown.poke0_valve > 0)
-		if (--pulse_countdown.poke0_valve == 0)
-			clr_POKE0_VALVE;
-	if (pulse_countdown.poke1_valve > 0)
-		if (--pulse_countdown.poke1_valve == 0)
-			clr_POKE1_VALVE;
-	if (pulse_countdown.poke2_valve > 0)
-		if (--pulse_countdown.poke2_valve == 0)
-			clr_POKE2_VALVE;
-
-	if (pulse_countdown.led0 > 0)
-		if (--pulse_countdown.led0 == 0)
-			clr_LED0;
-	if (pulse_countdown.led1 > 0)
-		if (--pulse_countdown.led1 == 0)
-			clr_LED1;
-
-	if (pulse_countdown.rgb0 > 0)
-		if (--pulse_countdown.rgb0 == 0)
-			rgb0_on = false;
-	if (pulse_countdown.rgb1 > 0)
-		if (--pulse_countdown.rgb1 == 0)
-			rgb1_on = false;
-
-	if ((prev_rgb0_on != rgb0_on) || (prev_rgb1_on != rgb1_on))
+	profiler_start();
+	
+	/* The tick only runs while pulses are queued, and nothing else happens until the earliest one ends */
+	if (pulse_queued && ++pulse_tick == pulse_next_deadline)
 	{
-		handle_Rgbs(rgb0_on, rgb1_on);
+		bool prev_rgb0_on, prev_rgb1_on;
+		prev_rgb0_on = rgb0_on;
+		prev_rgb1_on = rgb1_on;
+		
+		uint8_t channel;
+		
+		while ((channel = pulse_pop_expired()) != PULSE_NONE)
+			pulse_expire(channel);
+		
+		if ((prev_rgb0_on != rgb0_on) || (prev_rgb1_on != rgb1_on))
+		{
+			handle_Rgbs(rgb0_on, rgb1_on);
+		}
 	}
 	
-	if (pulse_countdown.do0 > 0)
-	    if (--pulse_countdown.do0 == 0)
-	    {
-    	    clr_DO0;
-    	    if (_states_.pwm.do0)
-    	    {
-        	    _states_.pwm.do0 = false;
-        	    timer_type0_stop(&TCF0);
-    	    }
-	    }
-	if (pulse_countdown.do1 > 0)
-	    if (--pulse_countdown.do1 == 0)
-	    {
-    	    clr_DO1;
-    	    if (_states_.pwm.do1)
-    	    {
-        	    _states_.pwm.do1 = false;
-        	    timer_type0_stop(&TCE0);
-    	    }
-	    }
-	if (pulse_countdown.do2 > 0)
-	    if (--pulse_countdown.do2 == 0)
-	    {
-    	    clr_DO2;
-    	    if (_states_.pwm.do2)
-    	    {
-        	    _states_.pwm.do2 = false;
-        	    timer_type0_stop(&TCD0);
-    	    }
-	    }
-	if (pulse_countdown.do3 > 0)
-	    if (--pulse_countdown.do3 == 0)
-	    {
-    	    clr_DO3;
-    	    if (_states_.pwm.do3)
-    	    {
-        	    _states_.pwm.do3 = false;
-        	    timer_type0_stop(&TCC0);
-    	    }
-	    }
+	/* Trains in high resolution mode complete from the TCF1 interrupt */
+	if (pulse_train_done)
+		pulse_train_report();
+	
+	profiler_stop(PROFILER_T_500US);
 }
 
-uint8_t int0_enable_counter = 0;
-uint8_t int1_enable_counter = 0;
-uint8_t int2_enable_counter = 0;
-
 void core_callback_t_1ms(void)
 {
-	if (int0_enable_counter)
-		if ((--int0_enable_counter) == 0)
-			PORTD_INTCTRL |= INT_LEVEL_LOW;
+	profiler_start();
+	
+	if (pwm_chirp_active)
+		pwm_chirp_update();
+	
+	if (edge_fifo_queued)
+		edge_fifo_send();
+	
+	edge_count_tick();
 	
-	if (int1_enable_counter)
-		if ((--int1_enable_counter) == 0)
-			PORTE_INTCTRL |= INT_LEVEL_LOW;
+	/* Catches a CCB match lost when the core writes TCC1 to set or synchronize the timestamp */
+	if (schedule_queued || di_holding)
+		timestamp_compare_service();
 	
-	if (int2_enable_counter)
-		if ((--int2_enable_counter) == 0)
-			PORTF_INTCTRL |= INT_LEVEL_LOW;
+	profiler_stop(PROFILER_T_1MS);
 }
 
 /************************************************************************/
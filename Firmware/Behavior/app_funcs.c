@@ -1,15 +1,15 @@
 #include "app_funcs.h"
 #include "app_ios_and_regs.h"
 #include "hwbp_core.h"
+#include "hwbp_core_types.h"
 
 #define F_CPU 32000000
 #include <util/delay.h>
+#include <math.h>
 
 #include "WS2812S.h"
 #include "structs.h"
 
-extern countdown_t pulse_countdown;
-
 extern timer_conf_t timer_conf;
 extern is_new_timer_conf_t is_new_timer_conf;
 
@@ -73,20 +73,20 @@ void (*app_func_rd_pointer[])(void) = {
 	&app_read_REG_DIS_SERVOS,
 	&app_read_REG_EN_ENCODERS,
 	&app_read_REG_CONF_ENCODERS,
-	&app_read_REG_RESERVED2,
-	&app_read_REG_RESERVED3,
-	&app_read_REG_RESERVED4,
-	&app_read_REG_RESERVED5,
-	&app_read_REG_RESERVED6,
-	&app_read_REG_RESERVED7,
-	&app_read_REG_RESERVED8,
-	&app_read_REG_RESERVED9,
+	&app_read_REG_PROFILER_CTRL,
+	&app_read_REG_PROFILER_POKES,
+	&app_read_REG_PROFILER_TIMERS_OVF,
+	&app_read_REG_PROFILER_TIMERS_CCA,
+	&app_read_REG_PROFILER_ADC,
+	&app_read_REG_PROFILER_SERIAL_TSTAMP,
+	&app_read_REG_PROFILER_T_1MS,
+	&app_read_REG_PROFILER_T_500US,
 	&app_read_REG_CAM_OUT0_FRAME_ACQUIRED,
 	&app_read_REG_CAM_OUT0_FREQ,
 	&app_read_REG_CAM_OUT1_FRAME_ACQUIRED,
 	&app_read_REG_CAM_OUT1_FREQ,
-	&app_read_REG_RESERVED10,
-	&app_read_REG_RESERVED11,
+	&app_read_REG_TX_BUFFER_STATS,
+	&app_read_REG_CPU_LOAD,
 	&app_read_REG_RESERVED12,
 	&app_read_REG_RESERVED13,
 	&app_read_REG_MOTOR_OUT2_PERIOD,
@@ -111,7 +111,49 @@ void (*app_func_rd_pointer[])(void) = {
   	&app_read_REG_MIMIC_PORT2_VALVE,
   	&app_read_REG_RESERVED23,
   	&app_read_REG_RESERVED24,
-  	&app_read_REG_POKE_INPUT_FILTER_MS
+  	&app_read_REG_POKE_INPUT_FILTER_MS,
+	&app_read_REG_PULSE_HIGH_RES,
+	&app_read_REG_TRAIN_WIDTH,
+	&app_read_REG_TRAIN_PERIOD,
+	&app_read_REG_TRAIN_COUNT,
+	&app_read_REG_TRAIN_START,
+	&app_read_REG_TRAIN_STOP,
+	&app_read_REG_TRAIN_DONE,
+	&app_read_REG_SCHEDULE_ADD,
+	&app_read_REG_SCHEDULE_DEPTH,
+	&app_read_REG_SCHEDULE_FLUSH,
+	&app_read_REG_SCHEDULE_DONE,
+	&app_read_REG_TRANSACTION,
+	&app_read_REG_START_AT,
+	&app_read_REG_PWM_START_SYNC,
+	&app_read_REG_PWM_PHASE,
+	&app_read_REG_CHIRP_FREQ_START,
+	&app_read_REG_CHIRP_FREQ_END,
+	&app_read_REG_CHIRP_DURATION,
+	&app_read_REG_CHIRP_SHAPE,
+	&app_read_REG_CHIRP_START,
+	&app_read_REG_WAVEFORM_DATA,
+	&app_read_REG_WAVEFORM_LENGTH,
+	&app_read_REG_WAVEFORM_RATE,
+	&app_read_REG_WAVEFORM_REPEAT,
+	&app_read_REG_WAVEFORM_TRIGGER,
+	&app_read_REG_WAVEFORM_START,
+	&app_read_REG_WAVEFORM_STOP,
+	&app_read_REG_WAVEFORM_DONE,
+	&app_read_REG_PWM_FREQ_FINE,
+	&app_read_REG_PWM_DCYCLE_FINE,
+	&app_read_REG_POKE_CAPTURE,
+	&app_read_REG_DI_DEBOUNCE_RISE,
+	&app_read_REG_DI_DEBOUNCE_FALL,
+	&app_read_REG_EDGE_FIFO,
+	&app_read_REG_EDGE_FIFO_EN,
+	&app_read_REG_EDGE_COUNT_RISING,
+	&app_read_REG_EDGE_COUNT_FALLING,
+	&app_read_REG_EDGE_COUNT_WINDOW,
+	&app_read_REG_EDGE_COUNTS,
+	&app_read_REG_MIMIC_HW,
+	&app_read_REG_MIMIC_HW_ROUTED,
+	&app_read_REG_EVNT_ENABLE_EXT
 };
 
 bool (*app_func_wr_pointer[])(void*) = {
@@ -167,20 +209,20 @@ bool (*app_func_wr_pointer[])(void*) = {
 	&app_write_REG_DIS_SERVOS,
 	&app_write_REG_EN_ENCODERS,
 	&app_write_REG_CONF_ENCODERS,
-	&app_write_REG_RESERVED2,
-	&app_write_REG_RESERVED3,
-	&app_write_REG_RESERVED4,
-	&app_write_REG_RESERVED5,
-	&app_write_REG_RESERVED6,
-	&app_write_REG_RESERVED7,
-	&app_write_REG_RESERVED8,
-	&app_write_REG_RESERVED9,
+	&app_write_REG_PROFILER_CTRL,
+	&app_write_REG_PROFILER_POKES,
+	&app_write_REG_PROFILER_TIMERS_OVF,
+	&app_write_REG_PROFILER_TIMERS_CCA,
+	&app_write_REG_PROFILER_ADC,
+	&app_write_REG_PROFILER_SERIAL_TSTAMP,
+	&app_write_REG_PROFILER_T_1MS,
+	&app_write_REG_PROFILER_T_500US,
 	&app_write_REG_CAM_OUT0_FRAME_ACQUIRED,
 	&app_write_REG_CAM_OUT0_FREQ,
 	&app_write_REG_CAM_OUT1_FRAME_ACQUIRED,
 	&app_write_REG_CAM_OUT1_FREQ,
-	&app_write_REG_RESERVED10,
-	&app_write_REG_RESERVED11,
+	&app_write_REG_TX_BUFFER_STATS,
+	&app_write_REG_CPU_LOAD,
 	&app_write_REG_RESERVED12,
 	&app_write_REG_RESERVED13,
 	&app_write_REG_MOTOR_OUT2_PERIOD,
@@ -205,7 +247,49 @@ bool (*app_func_wr_pointer[])(void*) = {
 	&app_write_REG_MIMIC_PORT2_VALVE,
 	&app_write_REG_RESERVED23,
 	&app_write_REG_RESERVED24,
-	&app_write_REG_POKE_INPUT_FILTER_MS
+	&app_write_REG_POKE_INPUT_FILTER_MS,
+	&app_write_REG_PULSE_HIGH_RES,
+	&app_write_REG_TRAIN_WIDTH,
+	&app_write_REG_TRAIN_PERIOD,
+	&app_write_REG_TRAIN_COUNT,
+	&app_write_REG_TRAIN_START,
+	&app_write_REG_TRAIN_STOP,
+	&app_write_REG_TRAIN_DONE,
+	&app_write_REG_SCHEDULE_ADD,
+	&app_write_REG_SCHEDULE_DEPTH,
+	&app_write_REG_SCHEDULE_FLUSH,
+	&app_write_REG_SCHEDULE_DONE,
+	&app_write_REG_TRANSACTION,
+	&app_write_REG_START_AT,
+	&app_write_REG_PWM_START_SYNC,
+	&app_write_REG_PWM_PHASE,
+	&app_write_REG_CHIRP_FREQ_START,
+	&app_write_REG_CHIRP_FREQ_END,
+	&app_write_REG_CHIRP_DURATION,
+	&app_write_REG_CHIRP_SHAPE,
+	&app_write_REG_CHIRP_START,
+	&app_write_REG_WAVEFORM_DATA,
+	&app_write_REG_WAVEFORM_LENGTH,
+	&app_write_REG_WAVEFORM_RATE,
+	&app_write_REG_WAVEFORM_REPEAT,
+	&app_write_REG_WAVEFORM_TRIGGER,
+	&app_write_REG_WAVEFORM_START,
+	&app_write_REG_WAVEFORM_STOP,
+	&app_write_REG_WAVEFORM_DONE,
+	&app_write_REG_PWM_FREQ_FINE,
+	&app_write_REG_PWM_DCYCLE_FINE,
+	&app_write_REG_POKE_CAPTURE,
+	&app_write_REG_DI_DEBOUNCE_RISE,
+	&app_write_REG_DI_DEBOUNCE_FALL,
+	&app_write_REG_EDGE_FIFO,
+	&app_write_REG_EDGE_FIFO_EN,
+	&app_write_REG_EDGE_COUNT_RISING,
+	&app_write_REG_EDGE_COUNT_FALLING,
+	&app_write_REG_EDGE_COUNT_WINDOW,
+	&app_write_REG_EDGE_COUNTS,
+	&app_write_REG_MIMIC_HW,
+	&app_write_REG_MIMIC_HW_ROUTED,
+	&app_write_REG_EVNT_ENABLE_EXT
 };
 
 
@@ -214,10 +298,13 @@ bool (*app_func_wr_pointer[])(void*) = {
 /************************************************************************/
 void app_read_REG_PORT_DIS(void)
 {
-	app_regs.REG_PORT_DIS = (read_POKE0_IR) ? B_DI0 : 0;
-	app_regs.REG_PORT_DIS |= (read_POKE1_IR) ? B_DI1 : 0;
-	app_regs.REG_PORT_DIS |= (read_POKE2_IR) ? B_DI2 : 0;
-	app_regs.REG_PORT_DIS |= (read_DI3) ? B_DI3 : 0;
+	uint8_t reg = (read_POKE0_IR) ? B_DI0 : 0;
+	reg |= (read_POKE1_IR) ? B_DI1 : 0;
+	reg |= (read_POKE2_IR) ? B_DI2 : 0;
+	reg |= (read_DI3) ? B_DI3 : 0;
+	
+	/* Lines holding off keep the state their last event reported */
+	app_regs.REG_PORT_DIS = (app_regs.REG_PORT_DIS & di_holding) | (reg & ~di_holding);
 }
 bool app_write_REG_PORT_DIS(void *a) { return false; }
 
@@ -234,30 +321,432 @@ bool app_write_REG_RESERVED0(void *a)
 }
 
 
+/************************************************************************/
+/* Pulse scheduler                                                      */
+/************************************************************************/
+uint16_t pulse_tick = 0;
+uint16_t pulse_next_deadline = 0;
+uint8_t pulse_queued = 0;
+
+static uint8_t pulse_queue[PULSE_CHANNELS];
+static uint16_t pulse_deadline[PULSE_CHANNELS];
+
+static uint8_t pulse_us_queue[PULSE_CHANNELS];
+static uint32_t pulse_us_deadline[PULSE_CHANNELS];
+static uint8_t pulse_us_queued = 0;
+
+/* Must be called with interrupts disabled */
+static void pulse_remove(uint8_t * queue, uint8_t * queued, uint8_t channel)
+{
+	uint8_t i;
+	
+	for (i = 0; i < *queued; i++)
+		if (queue[i] == channel)
+			break;
+	
+	if (i == *queued)
+		return;
+	
+	for ((*queued)--; i < *queued; i++)
+		queue[i] = queue[i + 1];
+}
+
+void pulse_schedule(uint8_t channel, uint16_t ticks)
+{
+	uint8_t sreg = SREG;
+	cli();
+	
+	pulse_remove(pulse_queue, &pulse_queued, channel);
+	pulse_remove(pulse_us_queue, &pulse_us_queued, channel);
+	
+	if (ticks)
+	{
+		/* Deadlines are less than 65536 ticks away, so the distance orders them across the wrap */
+		uint8_t i = pulse_queued;
+		
+		while (i > 0 && (uint16_t)(pulse_deadline[pulse_queue[i - 1]] - pulse_tick) > ticks)
+		{
+			pulse_queue[i] = pulse_queue[i - 1];
+			i--;
+		}
+		
+		pulse_queue[i] = channel;
+		pulse_deadline[channel] = pulse_tick + ticks;
+		pulse_queued++;
+	}
+	
+	if (pulse_queued)
+		pulse_next_deadline = pulse_deadline[pulse_queue[0]];
+	
+	SREG = sreg;
+}
+
+uint8_t pulse_pop_expired(void)
+{
+	uint8_t channel = PULSE_NONE;
+	
+	uint8_t sreg = SREG;
+	cli();
+	
+	if (pulse_queued && pulse_deadline[pulse_queue[0]] == pulse_tick)
+	{
+		channel = pulse_queue[0];
+		pulse_remove(pulse_queue, &pulse_queued, channel);
+		
+		if (pulse_queued)
+			pulse_next_deadline = pulse_deadline[pulse_queue[0]];
+	}
+	
+	SREG = sreg;
+	return channel;
+}
+
+
+/************************************************************************/
+/* High resolution pulses                                               */
+/************************************************************************/
+uint16_t pulse_us_epoch = 0;
+
+static bool pulse_us_running = false;
+
+/* Must be called with interrupts disabled */
+static uint32_t pulse_us_now(void)
+{
+	uint16_t cnt = TCF1_CNT;
+	uint16_t epoch = pulse_us_epoch;
+	
+	/* An overflow still waiting for its interrupt already happened if the count is low */
+	if ((TCF1_INTFLAGS & TC1_OVFIF_bm) && cnt < 0x8000)
+		epoch++;
+	
+	return ((uint32_t)epoch << 16) | cnt;
+}
+
+/* Must be called with interrupts disabled */
+void pulse_us_expire(void)
+{
+	while (pulse_us_queued)
+	{
+		uint8_t channel = pulse_us_queue[0];
+		
+		/* CCA matches the low 16 bits once per overflow, so check the deadline after loading it */
+		TCF1_CCA = (uint16_t)pulse_us_deadline[channel];
+		TCF1_INTFLAGS = TC1_CCAIF_bm;
+		
+		if ((int32_t)(pulse_us_deadline[channel] - pulse_us_now()) > 0)
+		{
+			TCF1_INTCTRLB = TC_CCAINTLVL_HI_gc;
+			return;
+		}
+		
+		pulse_remove(pulse_us_queue, &pulse_us_queued, channel);
+		pulse_expire(channel);
+	}
+	
+	TCF1_INTCTRLB = TC_CCAINTLVL_OFF_gc;
+	pulse_us_timer_update();
+}
+
+/* Must be called with interrupts disabled, the caller arms the compare */
+static void pulse_us_insert(uint8_t channel, uint32_t deadline)
+{
+	pulse_remove(pulse_queue, &pulse_queued, channel);
+	pulse_remove(pulse_us_queue, &pulse_us_queued, channel);
+	
+	if (pulse_queued)
+		pulse_next_deadline = pulse_deadline[pulse_queue[0]];
+	
+	uint8_t i = pulse_us_queued;
+	
+	while (i > 0 && (int32_t)(pulse_us_deadline[pulse_us_queue[i - 1]] - deadline) > 0)
+	{
+		pulse_us_queue[i] = pulse_us_queue[i - 1];
+		i--;
+	}
+	
+	pulse_us_queue[i] = channel;
+	pulse_us_deadline[channel] = deadline;
+	pulse_us_queued++;
+}
+
+void pulse_schedule_us(uint8_t channel, uint16_t us)
+{
+	uint8_t sreg = SREG;
+	cli();
+	
+	pulse_us_insert(channel, pulse_us_now() + (uint32_t)us * PULSE_US_COUNTS);
+	
+	/* Arms the compare, or ends the pulse here if it's already due */
+	pulse_us_expire();
+	
+	SREG = sreg;
+}
+
+/* TCF1 runs while any output is in high resolution mode or still has a pulse to end, */
+/* and while it captures the edges of poke 2                                           */
+void pulse_us_timer_update(void)
+{
+	bool run = app_regs.REG_PULSE_HIGH_RES || pulse_us_queued || (app_regs.REG_POKE_CAPTURE & B_DI2);
+	
+	if (run && !pulse_us_running)
+	{
+		TCF1_CTRLA = TC_CLKSEL_OFF_gc;
+		TCF1_INTCTRLB = TC_CCAINTLVL_OFF_gc;
+		TCF1_INTFLAGS = TCF1_INTFLAGS;
+		TCF1_CNT = 0;
+		TCF1_PER = 0xFFFF;
+		pulse_us_epoch = 0;
+		TCF1_INTCTRLA = TC_OVFINTLVL_HI_gc;
+		
+		/* 4 counts per microsecond */
+		TCF1_CTRLA = TC_CLKSEL_DIV8_gc;
+		
+		pulse_us_running = true;
+	}
+	
+	if (!run && pulse_us_running)
+	{
+		pulse_us_running = false;
+		
+		TCF1_CTRLA = TC_CLKSEL_OFF_gc;
+		TCF1_INTCTRLA = TC_OVFINTLVL_OFF_gc;
+	}
+}
+
+
+/************************************************************************/
+/* Pulse trains                                                         */
+/************************************************************************/
+uint16_t pulse_train_done = 0;
+
+static uint16_t train_active = 0;
+static uint16_t train_on = 0;
+static uint16_t train_endless = 0;
+static uint16_t train_us = 0;
+
+/* Latched when the train starts */
+static uint16_t train_width[TRAIN_CHANNELS];
+static uint16_t train_gap[TRAIN_CHANNELS];
+static uint16_t train_left[TRAIN_CHANNELS];
+
+static const uint8_t train_channel[TRAIN_CHANNELS] = {
+	PULSE_POKE0_VALVE, PULSE_POKE1_VALVE, PULSE_POKE2_VALVE, PULSE_DO0, PULSE_DO1, PULSE_DO2, PULSE_DO3
+};
+
+/* Pulse channels and output bits share their numbering */
+#define train_bit(channel) (1 << (channel))
+
+static uint8_t train_index(uint8_t channel)
+{
+	if (channel >= PULSE_DO0)
+		return channel - PULSE_DO0 + 3;
+	
+	return channel - PULSE_POKE0_VALVE;
+}
+
+static void train_set(uint8_t channel)
+{
+	switch (channel)
+	{
+		case PULSE_POKE0_VALVE: set_POKE0_VALVE; break;
+		case PULSE_POKE1_VALVE: set_POKE1_VALVE; break;
+		case PULSE_POKE2_VALVE: set_POKE2_VALVE; break;
+		case PULSE_DO0: set_DO0; break;
+		case PULSE_DO1: set_DO1; break;
+		case PULSE_DO2: set_DO2; break;
+		case PULSE_DO3: set_DO3; break;
+	}
+}
+
+/* Must be called with interrupts disabled, from the expiry of the previous edge */
+static void train_next(uint8_t channel, uint16_t duration)
+{
+	if (train_us & train_bit(channel))
+	{
+		uint32_t deadline = pulse_us_deadline[channel] + (uint32_t)duration * PULSE_US_COUNTS;
+		uint32_t now = pulse_us_now();
+		
+		/* An edge served too late starts its part now, so the expiry loop never chases the train */
+		if ((int32_t)(deadline - now) <= 0)
+			deadline = now + (uint32_t)duration * PULSE_US_COUNTS;
+		
+		pulse_us_insert(channel, deadline);
+	}
+	else
+	{
+		pulse_schedule(channel, duration);
+	}
+}
+
+bool pulse_train_step(uint8_t channel)
+{
+	uint16_t bit = train_bit(channel);
+	bool took_over = false;
+	
+	uint8_t sreg = SREG;
+	cli();
+	
+	if (train_active & bit)
+	{
+		uint8_t i = train_index(channel);
+		
+		if (train_on & bit)
+		{
+			/* The pulse ended, the caller clears the output */
+			train_on &= ~bit;
+			
+			if ((train_endless & bit) || --train_left[i])
+			{
+				train_next(channel, train_gap[i]);
+			}
+			else
+			{
+				train_active &= ~bit;
+				pulse_train_done |= bit;
+			}
+		}
+		else
+		{
+			train_on |= bit;
+			train_set(channel);
+			train_next(channel, train_width[i]);
+			took_over = true;
+		}
+	}
+	
+	SREG = sreg;
+	return took_over;
+}
+
+void pulse_train_report(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+	app_regs.REG_TRAIN_DONE = pulse_train_done;
+	pulse_train_done = 0;
+	SREG = sreg;
+	
+	if (app_regs.REG_EVNT_ENABLE & B_EVT_TRAIN_DONE)
+		tx_send_event(ADD_REG_TRAIN_DONE, true);
+}
+
+
+/************************************************************************/
+/* Output schedule                                                      */
+/************************************************************************/
+uint8_t schedule_queued = 0;
+
+/* Ring buffer sorted by timestamp, the capacity is a power of two */
+static scheduled_output_t schedule[SCHEDULE_CAPACITY];
+static uint8_t schedule_head = 0;
+
+#define schedule_at(i) schedule[(schedule_head + (i)) & (SCHEDULE_CAPACITY - 1)]
+
+static bool schedule_is_later(scheduled_output_t * entry, uint32_t second, uint16_t usecond)
+{
+	return (entry->second > second) || (entry->second == second && entry->usecond > usecond);
+}
+
+/* Must be called with interrupts disabled */
+static void timestamp_now(uint32_t * second, uint16_t * usecond)
+{
+	*usecond = TCC1_CNT;
+	*second = core_func_read_R_TIMESTAMP_SECOND();
+	
+	/* The core's overflow interrupt didn't count the new second yet if the count is low */
+	if ((TCC1_INTFLAGS & TC1_OVFIF_bm) && *usecond < 31250 / 2)
+		(*second)++;
+}
+
+/* Must be called with interrupts disabled */
+static bool schedule_head_is_due(void)
+{
+	uint32_t second;
+	uint16_t usecond;
+	
+	timestamp_now(&second, &usecond);
+	
+	return !schedule_is_later(&schedule[schedule_head], second, usecond);
+}
+
+/* Must be called with interrupts disabled, the caller loads CCB */
+static void schedule_insert(scheduled_output_t * entry)
+{
+	uint8_t i = schedule_queued;
+	
+	/* Uploads are usually in order, so the search starts at the tail */
+	while (i > 0 && schedule_is_later(&schedule_at(i - 1), entry->second, entry->usecond))
+	{
+		schedule_at(i) = schedule_at(i - 1);
+		i--;
+	}
+	
+	schedule_at(i) = *entry;
+	schedule_queued++;
+}
+
+static void schedule_execute(scheduled_output_t * entry)
+{
+	if (entry->set) app_write_REG_OUTPUTS_SET(&entry->set);
+	if (entry->clear) app_write_REG_OUTPUTS_CLEAR(&entry->clear);
+	if (entry->toggle) app_write_REG_OUTPUTS_TOGGLE(&entry->toggle);
+	
+	if (entry->pwm_start) app_write_REG_PWM_START(&entry->pwm_start);
+	
+	if (entry->cameras_start)
+	{
+		start_selected_cameras(entry->cameras_start);
+		app_regs.REG_START_CAMERAS = entry->cameras_start;
+	}
+	
+	app_regs.REG_SCHEDULE_DONE[0] = app_regs.REG_OUTPUTS_OUT;
+	app_regs.REG_SCHEDULE_DONE[1] = schedule_queued;
+	
+	if (app_regs.REG_EVNT_ENABLE & B_EVT_SCHEDULE_DONE)
+		tx_send_event(ADD_REG_SCHEDULE_DONE, true);
+}
+
+/* Must be called with interrupts disabled */
+static void schedule_run_due(void)
+{
+	while (schedule_queued && schedule_head_is_due())
+	{
+		scheduled_output_t entry = schedule[schedule_head];
+		schedule_head = (schedule_head + 1) & (SCHEDULE_CAPACITY - 1);
+		schedule_queued--;
+		
+		/* Runs with interrupts disabled so operations due together keep their order */
+		schedule_execute(&entry);
+	}
+}
+
+
 /************************************************************************/
 /* REG_OUTPUTS_SET                                                      */
 /************************************************************************/
 bool rgb0_on = false;
 bool rgb1_on = false;
 
-#define start_POKE0_LED do {set_POKE0_LED; if (app_regs.REG_OUTPUT_PULSE_EN & B_PORT0_DO) pulse_countdown.poke0_led = app_regs.REG_PULSE_PORT0_DO + 1; } while(0)
-#define start_POKE1_LED do {set_POKE1_LED; if (app_regs.REG_OUTPUT_PULSE_EN & B_PORT1_DO) pulse_countdown.poke1_led = app_regs.REG_PULSE_PORT1_DO + 1; } while(0)
-#define start_POKE2_LED do {set_POKE2_LED; if (app_regs.REG_OUTPUT_PULSE_EN & B_PORT2_DO) pulse_countdown.poke2_led = app_regs.REG_PULSE_PORT2_DO + 1; } while(0)
+#define pulse_start(channel, mask, duration) do { if (app_regs.REG_OUTPUT_PULSE_EN & (mask)) { if (app_regs.REG_PULSE_HIGH_RES & (mask)) pulse_schedule_us(channel, duration); else pulse_schedule(channel, (duration) + 1); } } while(0)
+
+#define start_POKE0_LED do {set_POKE0_LED; pulse_start(PULSE_POKE0_LED, B_PORT0_DO, app_regs.REG_PULSE_PORT0_DO); } while(0)
+#define start_POKE1_LED do {set_POKE1_LED; pulse_start(PULSE_POKE1_LED, B_PORT1_DO, app_regs.REG_PULSE_PORT1_DO); } while(0)
+#define start_POKE2_LED do {set_POKE2_LED; pulse_start(PULSE_POKE2_LED, B_PORT2_DO, app_regs.REG_PULSE_PORT2_DO); } while(0)
 
-#define start_POKE0_VALVE do {set_POKE0_VALVE; if (app_regs.REG_OUTPUT_PULSE_EN & B_PORT0_12V) pulse_countdown.poke0_valve = app_regs.REG_PULSE_PORT0_12V + 1; } while(0)
-#define start_POKE1_VALVE do {set_POKE1_VALVE; if (app_regs.REG_OUTPUT_PULSE_EN & B_PORT1_12V) pulse_countdown.poke1_valve = app_regs.REG_PULSE_PORT1_12V + 1; } while(0)
-#define start_POKE2_VALVE do {set_POKE2_VALVE; if (app_regs.REG_OUTPUT_PULSE_EN & B_PORT2_12V) pulse_countdown.poke2_valve = app_regs.REG_PULSE_PORT2_12V + 1; } while(0)
+#define start_POKE0_VALVE do {set_POKE0_VALVE; pulse_start(PULSE_POKE0_VALVE, B_PORT0_12V, app_regs.REG_PULSE_PORT0_12V); } while(0)
+#define start_POKE1_VALVE do {set_POKE1_VALVE; pulse_start(PULSE_POKE1_VALVE, B_PORT1_12V, app_regs.REG_PULSE_PORT1_12V); } while(0)
+#define start_POKE2_VALVE do {set_POKE2_VALVE; pulse_start(PULSE_POKE2_VALVE, B_PORT2_12V, app_regs.REG_PULSE_PORT2_12V); } while(0)
 
-#define start_LED0 do {set_LED0; if (app_regs.REG_OUTPUT_PULSE_EN & B_LED0) pulse_countdown.led0 = app_regs.REG_PULSE_LED0 + 1; } while(0)
-#define start_LED1 do {set_LED1; if (app_regs.REG_OUTPUT_PULSE_EN & B_LED1) pulse_countdown.led1 = app_regs.REG_PULSE_LED1 + 1; } while(0)
+#define start_LED0 do {set_LED0; pulse_start(PULSE_LED0, B_LED0, app_regs.REG_PULSE_LED0); } while(0)
+#define start_LED1 do {set_LED1; pulse_start(PULSE_LED1, B_LED1, app_regs.REG_PULSE_LED1); } while(0)
 
-#define start_RGB0 do {rgb0_on = true; if (app_regs.REG_OUTPUT_PULSE_EN & B_RGB0) pulse_countdown.rgb0 = app_regs.REG_PULSE_RGB0 + 1; } while(0)
-#define start_RGB1 do {rgb1_on = true; if (app_regs.REG_OUTPUT_PULSE_EN & B_RGB1) pulse_countdown.rgb1 = app_regs.REG_PULSE_RGB1 + 1; } while(0)
+#define start_RGB0 do {rgb0_on = true; pulse_start(PULSE_RGB0, B_RGB0, app_regs.REG_PULSE_RGB0); } while(0)
+#define start_RGB1 do {rgb1_on = true; pulse_start(PULSE_RGB1, B_RGB1, app_regs.REG_PULSE_RGB1); } while(0)
 
-#define start_DO0 do {set_DO0; if (app_regs.REG_OUTPUT_PULSE_EN & B_DO0) pulse_countdown.do0 = app_regs.REG_PULSE_DO0 + 1; } while(0)
-#define start_DO1 do {set_DO1; if (app_regs.REG_OUTPUT_PULSE_EN & B_DO1) pulse_countdown.do1 = app_regs.REG_PULSE_DO1 + 1; } while(0)
-#define start_DO2 do {set_DO2; if (app_regs.REG_OUTPUT_PULSE_EN & B_DO2) pulse_countdown.do2 = app_regs.REG_PULSE_DO2 + 1; } while(0)
-#define start_DO3 do {set_DO3; if (app_regs.REG_OUTPUT_PULSE_EN & B_DO3) pulse_countdown.do3 = app_regs.REG_PULSE_DO3 + 1; } while(0)
+#define start_DO0 do {set_DO0; pulse_start(PULSE_DO0, B_DO0, app_regs.REG_PULSE_DO0); } while(0)
+#define start_DO1 do {set_DO1; pulse_start(PULSE_DO1, B_DO1, app_regs.REG_PULSE_DO1); } while(0)
+#define start_DO2 do {set_DO2; pulse_start(PULSE_DO2, B_DO2, app_regs.REG_PULSE_DO2); } while(0)
+#define start_DO3 do {set_DO3; pulse_start(PULSE_DO3, B_DO3, app_regs.REG_PULSE_DO3); } while(0)
 
 void handle_Rgbs(bool use_rgb0, bool use_rgb1)
 {
@@ -823,6 +1312,219 @@ bool app_write_REG_PULSE_DO3(void *a)
 }
 
 
+/************************************************************************/
+/* PWM timer configuration                                              */
+/************************************************************************/
+/* Lowest frequency whose period fits the 16-bit counter with each prescaler, DIV1 to DIV1024 */
+static const uint16_t pwm_min_freq[] = {489, 245, 123, 62, 8, 2, 1};
+
+/* The timer clock of each prescaler shifted left by these is always PWM_CLOCK_SHIFTED */
+static const uint8_t pwm_clock_shift[] = {7, 8, 9, 10, 13, 15, 17};
+#define PWM_CLOCK_SHIFTED 4096000000UL
+
+/* Duty cycles 0 to 99 % as fractions of 65536 */
+static const uint16_t pwm_dcycle_q16[] = {
+	    0,   655,  1311,  1966,  2621,  3277,  3932,  4588,  5243,  5898,
+	 6554,  7209,  7864,  8520,  9175,  9830, 10486, 11141, 11796, 12452,
+	13107, 13763, 14418, 15073, 15729, 16384, 17039, 17695, 18350, 19005,
+	19661, 20316, 20972, 21627, 22282, 22938, 23593, 24248, 24904, 25559,
+	26214, 26870, 27525, 28180, 28836, 29491, 30147, 30802, 31457, 32113,
+	32768, 33423, 34079, 34734, 35389, 36045, 36700, 37356, 38011, 38666,
+	39322, 39977, 40632, 41288, 41943, 42598, 43254, 43909, 44564, 45220,
+	45875, 46531, 47186, 47841, 48497, 49152, 49807, 50463, 51118, 51773,
+	52429, 53084, 53740, 54395, 55050, 55706, 56361, 57016, 57672, 58327,
+	58982, 59638, 60293, 60948, 61604, 62259, 62915, 63570, 64225, 64881
+};
+
+/* Duty cycle of each output as a fraction of 65536, set by REG_DCYCLE_DOx or REG_PWM_DCYCLE_FINE */
+static uint16_t pwm_dcycle_fraction[4] = {32768, 32768, 32768, 32768};
+
+static uint16_t pwm_dcycle_count(uint16_t target, uint16_t fraction)
+{
+	return ((uint32_t)target * fraction + 0x8000) >> 16;
+}
+
+/* Replaces calculate_timer_16bits() and its float divisions, freq_q16 is in */
+/* 1/65536 Hz and must be 1 to 10000 Hz                                      */
+static uint8_t pwm_freq_prescaler(uint32_t freq_q16)
+{
+	uint8_t i = 0;
+	
+	while ((freq_q16 >> 16) < pwm_min_freq[i])
+		i++;
+	
+	return i + 1;
+}
+
+static void pwm_conf_freq(uint32_t freq_q16, uint16_t fraction, uint8_t * prescaler, uint16_t * target, uint16_t * dcycle_count, bool * is_new)
+{
+	uint8_t i = pwm_freq_prescaler(freq_q16) - 1;
+	
+	/* The frequency scaled like the clock keeps the most resolution the division allows */
+	uint32_t freq = (pwm_clock_shift[i] <= 16) ? freq_q16 >> (16 - pwm_clock_shift[i]) : freq_q16 << (pwm_clock_shift[i] - 16);
+	uint16_t period = (PWM_CLOCK_SHIFTED + freq / 2) / freq;
+	uint16_t count = pwm_dcycle_count(period, fraction);
+	
+	/* The timer's overflow interrupt may pick the configuration up at any time */
+	uint8_t sreg = SREG;
+	cli();
+	*prescaler = i + 1;
+	*target = period;
+	*dcycle_count = count;
+	*is_new = true;
+	SREG = sreg;
+}
+
+static void pwm_conf_dcycle(uint16_t fraction, uint16_t target, uint16_t * dcycle_count, bool * is_new)
+{
+	uint16_t count = pwm_dcycle_count(target, fraction);
+	
+	uint8_t sreg = SREG;
+	cli();
+	*dcycle_count = count;
+	*is_new = true;
+	SREG = sreg;
+}
+
+
+/************************************************************************/
+/* PWM synchronization                                                  */
+/************************************************************************/
+/* The outputs started by REG_PWM_START_SYNC count the prescaled clock of  */
+/* event channel 1 and keep it across new frequencies. The channel follows */
+/* their prescaler as long as they all share it.                          */
+static TC0_t * const pwm_timer[4] = {&TCF0, &TCE0, &TCD0, &TCC0};
+
+/* Indexed by the timer prescaler */
+static const uint8_t pwm_event_prescaler[8] = {
+	EVSYS_CHMUX_OFF_gc, EVSYS_CHMUX_PRESCALER_1_gc, EVSYS_CHMUX_PRESCALER_2_gc, EVSYS_CHMUX_PRESCALER_4_gc,
+	EVSYS_CHMUX_PRESCALER_8_gc, EVSYS_CHMUX_PRESCALER_64_gc, EVSYS_CHMUX_PRESCALER_256_gc, EVSYS_CHMUX_PRESCALER_1024_gc
+};
+
+static uint8_t pwm_event_source(uint8_t prescaler)
+{
+	/* The slowest outputs of the extended range already run from event channel 3 */
+	if (prescaler == TC_CLKSEL_EVCH3_gc)
+		return EVSYS_CHMUX_PRESCALER_32768_gc;
+	
+	return pwm_event_prescaler[prescaler];
+}
+
+static bool pwm_is_synced(uint8_t i)
+{
+	return pwm_timer[i]->CTRLA == TC_CLKSEL_EVCH1_gc;
+}
+
+/* False when output i is synchronized with others the prescaler doesn't suit */
+static bool pwm_sync_allows(uint8_t i, uint8_t prescaler)
+{
+	uint8_t current[4] = {timer_conf.prescaler_do0, timer_conf.prescaler_do1, timer_conf.prescaler_do2, timer_conf.prescaler_do3};
+	
+	if (!pwm_is_synced(i))
+		return true;
+	
+	for (uint8_t j = 0; j < 4; j++)
+		if (j != i && pwm_is_synced(j) && pwm_event_source(current[j]) != pwm_event_source(prescaler))
+			return false;
+	
+	return true;
+}
+
+/* Checks the prescaler output i is about to take and moves the channel to it */
+static bool pwm_sync_retune(uint8_t i, uint8_t prescaler)
+{
+	if (!pwm_sync_allows(i, prescaler))
+		return false;
+	
+	if (pwm_is_synced(i))
+		EVSYS_CH1MUX = pwm_event_source(prescaler);
+	
+	return true;
+}
+
+/* The output leaves the synchronization and counts its own prescaler again */
+static void pwm_sync_drop(uint8_t i, uint8_t prescaler)
+{
+	if (pwm_is_synced(i))
+		pwm_timer[i]->CTRLA = prescaler;
+}
+
+
+/************************************************************************/
+/* PWM chirps                                                           */
+/************************************************************************/
+uint8_t pwm_chirp_active = 0;
+
+static uint32_t chirp_freq[4];
+static uint32_t chirp_end[4];
+static int32_t chirp_step[4];
+static uint32_t chirp_ratio[4];
+static uint16_t chirp_left[4];
+static uint8_t chirp_exponential = 0;
+
+static void chirp_conf(uint8_t i, uint32_t freq_q16)
+{
+	uint8_t current[4] = {timer_conf.prescaler_do0, timer_conf.prescaler_do1, timer_conf.prescaler_do2, timer_conf.prescaler_do3};
+	
+	/* Outputs synchronized since the chirp started can't all follow it */
+	if (!pwm_sync_retune(i, pwm_freq_prescaler(freq_q16)))
+		pwm_sync_drop(i, current[i]);
+	
+	switch (i)
+	{
+		case 0: pwm_conf_freq(freq_q16, pwm_dcycle_fraction[0], &timer_conf.prescaler_do0, &timer_conf.target_do0, &timer_conf.dcycle_do0, &is_new_timer_conf.pwm_do0); break;
+		case 1: pwm_conf_freq(freq_q16, pwm_dcycle_fraction[1], &timer_conf.prescaler_do1, &timer_conf.target_do1, &timer_conf.dcycle_do1, &is_new_timer_conf.pwm_do1); break;
+		case 2: pwm_conf_freq(freq_q16, pwm_dcycle_fraction[2], &timer_conf.prescaler_do2, &timer_conf.target_do2, &timer_conf.dcycle_do2, &is_new_timer_conf.pwm_do2); break;
+		case 3: pwm_conf_freq(freq_q16, pwm_dcycle_fraction[3], &timer_conf.prescaler_do3, &timer_conf.target_do3, &timer_conf.dcycle_do3, &is_new_timer_conf.pwm_do3); break;
+	}
+}
+
+/* A new frequency replaces the chirp */
+static void pwm_chirp_cancel(uint8_t mask)
+{
+	uint8_t sreg = SREG;
+	cli();
+	pwm_chirp_active &= ~mask;
+	SREG = sreg;
+}
+
+void pwm_chirp_update(void)
+{
+	bool running[4] = {_states_.pwm.do0, _states_.pwm.do1, _states_.pwm.do2, _states_.pwm.do3};
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		uint8_t bit = 1 << i;
+		
+		if (!(pwm_chirp_active & bit))
+			continue;
+		
+		/* PWM_STOP or the end of a pulse ended the output */
+		if (!running[i])
+		{
+			pwm_chirp_active &= ~bit;
+			continue;
+		}
+		
+		if (--chirp_left[i] == 0)
+		{
+			chirp_freq[i] = chirp_end[i];
+			pwm_chirp_active &= ~bit;
+		}
+		else if (chirp_exponential & bit)
+		{
+			chirp_freq[i] = ((uint64_t)chirp_freq[i] * chirp_ratio[i]) >> 24;
+		}
+		else
+		{
+			chirp_freq[i] += chirp_step[i];
+		}
+		
+		chirp_conf(i, chirp_freq[i]);
+	}
+}
+
+
 /************************************************************************/
 /* REG_FREQ_DO0                                                         */
 /************************************************************************/
@@ -834,9 +1536,11 @@ bool app_write_REG_FREQ_DO0(void *a)
     if (reg < 1 || reg > 10000)
         return false;
     
-    calculate_timer_16bits(32000000, reg, &timer_conf.prescaler_do0, &timer_conf.target_do0);
-    timer_conf.dcycle_do0 = app_regs.REG_DCYCLE_DO0/100.0 * timer_conf.target_do0 + 0.5;    
-    is_new_timer_conf.pwm_do0 = true;
+    if (!pwm_sync_retune(0, pwm_freq_prescaler((uint32_t)reg << 16)))
+        return false;
+    
+    pwm_chirp_cancel(B_PWM_DO0);
+    pwm_conf_freq((uint32_t)reg << 16, pwm_dcycle_fraction[0], &timer_conf.prescaler_do0, &timer_conf.target_do0, &timer_conf.dcycle_do0, &is_new_timer_conf.pwm_do0);
 
 	app_regs.REG_FREQ_DO0 = reg;
 	return true;
@@ -854,9 +1558,11 @@ bool app_write_REG_FREQ_DO1(void *a)
     if (reg < 1 || reg > 10000)
         return false;
     
-    calculate_timer_16bits(32000000, reg, &timer_conf.prescaler_do1, &timer_conf.target_do1);
-    timer_conf.dcycle_do1 = app_regs.REG_DCYCLE_DO1/100.0 * timer_conf.target_do1 + 0.5;    
-    is_new_timer_conf.pwm_do1 = true;
+    if (!pwm_sync_retune(1, pwm_freq_prescaler((uint32_t)reg << 16)))
+        return false;
+    
+    pwm_chirp_cancel(B_PWM_DO1);
+    pwm_conf_freq((uint32_t)reg << 16, pwm_dcycle_fraction[1], &timer_conf.prescaler_do1, &timer_conf.target_do1, &timer_conf.dcycle_do1, &is_new_timer_conf.pwm_do1);
 
 	app_regs.REG_FREQ_DO1 = reg;
 	return true;
@@ -879,9 +1585,11 @@ bool app_write_REG_FREQ_DO2(void *a)
     if (reg < 1 || reg > 10000)
         return false;
     
-    calculate_timer_16bits(32000000, reg, &timer_conf.prescaler_do2, &timer_conf.target_do2);
-    timer_conf.dcycle_do2 = app_regs.REG_DCYCLE_DO2/100.0 * timer_conf.target_do2 + 0.5;    
-    is_new_timer_conf.pwm_do2 = true;
+    if (!pwm_sync_retune(2, pwm_freq_prescaler((uint32_t)reg << 16)))
+        return false;
+    
+    pwm_chirp_cancel(B_PWM_DO2);
+    pwm_conf_freq((uint32_t)reg << 16, pwm_dcycle_fraction[2], &timer_conf.prescaler_do2, &timer_conf.target_do2, &timer_conf.dcycle_do2, &is_new_timer_conf.pwm_do2);
 
 	app_regs.REG_FREQ_DO2 = reg;
 	return true;
@@ -904,9 +1612,11 @@ bool app_write_REG_FREQ_DO3(void *a)
     if (reg < 1 || reg > 10000)
         return false;
     
-    calculate_timer_16bits(32000000, reg, &timer_conf.prescaler_do3, &timer_conf.target_do3);
-    timer_conf.dcycle_do3 = app_regs.REG_DCYCLE_DO3/100.0 * timer_conf.target_do3 + 0.5;
-    is_new_timer_conf.pwm_do3 = true;
+    if (!pwm_sync_retune(3, pwm_freq_prescaler((uint32_t)reg << 16)))
+        return false;
+    
+    pwm_chirp_cancel(B_PWM_DO3);
+    pwm_conf_freq((uint32_t)reg << 16, pwm_dcycle_fraction[3], &timer_conf.prescaler_do3, &timer_conf.target_do3, &timer_conf.dcycle_do3, &is_new_timer_conf.pwm_do3);
 
 	app_regs.REG_FREQ_DO3 = reg;
 	return true;
@@ -924,11 +1634,11 @@ bool app_write_REG_DCYCLE_DO0(void *a)
 	if (reg < 1 || reg > 99)
 	    return false;
     
-    //calculate_timer_16bits(32000000, app_regs.REG_FREQ_DO0, &timer_conf.prescaler_do0, &timer_conf.target_do0);
-    timer_conf.dcycle_do0 = reg/100.0 * timer_conf.target_do0 + 0.5;
-    is_new_timer_conf.pwm_do0 = true;
+    pwm_dcycle_fraction[0] = pwm_dcycle_q16[reg];
+    pwm_conf_dcycle(pwm_dcycle_fraction[0], timer_conf.target_do0, &timer_conf.dcycle_do0, &is_new_timer_conf.pwm_do0);
     
 	app_regs.REG_DCYCLE_DO0 = reg;
+	app_regs.REG_PWM_DCYCLE_FINE[0] = reg * 100;
 	return true;
 }
 
@@ -949,11 +1659,11 @@ bool app_write_REG_DCYCLE_DO1(void *a)
 	if (reg < 1 || reg > 99)
 	    return false;
     
-    //calculate_timer_16bits(32000000, app_regs.REG_FREQ_DO0, &timer_conf.prescaler_do0, &timer_conf.target_do0);
-    timer_conf.dcycle_do1 = reg/100.0 * timer_conf.target_do1 + 0.5;
-    is_new_timer_conf.pwm_do1 = true;
+    pwm_dcycle_fraction[1] = pwm_dcycle_q16[reg];
+    pwm_conf_dcycle(pwm_dcycle_fraction[1], timer_conf.target_do1, &timer_conf.dcycle_do1, &is_new_timer_conf.pwm_do1);
 
 	app_regs.REG_DCYCLE_DO1 = reg;
+	app_regs.REG_PWM_DCYCLE_FINE[1] = reg * 100;
 	return true;
 }
 
@@ -974,11 +1684,11 @@ bool app_write_REG_DCYCLE_DO2(void *a)
 	if (reg < 1 || reg > 99)
 	    return false;
     
-    //calculate_timer_16bits(32000000, app_regs.REG_FREQ_DO0, &timer_conf.prescaler_do0, &timer_conf.target_do0);
-    timer_conf.dcycle_do2 = reg/100.0 * timer_conf.target_do2 + 0.5;
-    is_new_timer_conf.pwm_do2 = true;
+    pwm_dcycle_fraction[2] = pwm_dcycle_q16[reg];
+    pwm_conf_dcycle(pwm_dcycle_fraction[2], timer_conf.target_do2, &timer_conf.dcycle_do2, &is_new_timer_conf.pwm_do2);
 
 	app_regs.REG_DCYCLE_DO2 = reg;
+	app_regs.REG_PWM_DCYCLE_FINE[2] = reg * 100;
 	return true;
 }
 
@@ -999,11 +1709,11 @@ bool app_write_REG_DCYCLE_DO3(void *a)
 	if (reg < 1 || reg > 99)
 	    return false;
     
-    //calculate_timer_16bits(32000000, app_regs.REG_FREQ_DO0, &timer_conf.prescaler_do0, &timer_conf.target_do0);
-    timer_conf.dcycle_do3 = reg/100.0 * timer_conf.target_do3 + 0.5;
-    is_new_timer_conf.pwm_do3 = true;
+    pwm_dcycle_fraction[3] = pwm_dcycle_q16[reg];
+    pwm_conf_dcycle(pwm_dcycle_fraction[3], timer_conf.target_do3, &timer_conf.dcycle_do3, &is_new_timer_conf.pwm_do3);
 
 	app_regs.REG_DCYCLE_DO3 = reg;
+	app_regs.REG_PWM_DCYCLE_FINE[3] = reg * 100;
 	return true;
 }
 
@@ -1301,6 +2011,8 @@ bool app_write_REG_EVNT_ENABLE(void *a)
 	uint8_t reg = *((uint8_t*)a);
 
 	app_regs.REG_EVNT_ENABLE = reg;
+	
+	profiler_timer_update();
 	return true;
 }
 
@@ -1346,31 +2058,34 @@ void app_read_REG_START_CAMERAS(void)
     	app_regs.REG_START_CAMERAS |= B_EN_CAM_OUT1;
     }        
 }
-bool app_write_REG_START_CAMERAS(void *a)
+void start_selected_cameras(uint8_t reg)
 {
-	uint8_t reg = *((uint8_t*)a);
-    
     if ((reg & B_EN_CAM_OUT0) && !_states_.camera.do0)
     {
-        /* Make sure the output pin is equal to 0 for a while before start triggering the camera */
-        clr_DO0;
-        _delay_us(16);      // Measured, gives around 55us before the the first trigger pulse
-        
-        /* Start the camera */
-        start_cameras(&TCF0, app_regs.REG_CAM_OUT0_FREQ);        
+        start_cameras(&TCF0, app_regs.REG_CAM_OUT0_FREQ);
         _states_.camera.do0 = true;
     }
     
     if ((reg & B_EN_CAM_OUT1) && !_states_.camera.do1)
     {
-        /* Make sure the output pin is equal to 0 for a while before start triggering the camera */
-        clr_DO1;
-        _delay_us(16);      // Measured, gives around 55us before the the first trigger pulse
-            
-        /* Start the camera */
         start_cameras(&TCE0, app_regs.REG_CAM_OUT1_FREQ);
         _states_.camera.do1 = true;
     }
+}
+
+bool app_write_REG_START_CAMERAS(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+    
+    /* Make sure the output pins are equal to 0 for a while before start triggering the cameras */
+    if ((reg & B_EN_CAM_OUT0) && !_states_.camera.do0) clr_DO0;
+    if ((reg & B_EN_CAM_OUT1) && !_states_.camera.do1) clr_DO1;
+    
+    if (((reg & B_EN_CAM_OUT0) && !_states_.camera.do0) || ((reg & B_EN_CAM_OUT1) && !_states_.camera.do1))
+        _delay_us(16);      // Measured, gives around 55us before the the first trigger pulse
+    
+    /* Both cameras start together */
+    start_selected_cameras(reg);
 
 	app_regs.REG_START_CAMERAS = reg;
 	return true;
@@ -1490,6 +2205,9 @@ bool app_write_REG_EN_ENCODERS(void *a)
     {        
         _states_.quad_counter.port2 = true;
         
+        /* The encoder takes TCD1 back from the LED current waveforms */
+        waveform_stop(B_WAVEFORM_LED0 | B_WAVEFORM_LED1);
+        
         /* Turn off interrupts on the Encoder pins and redefine pins to input */
         PORTF_INTCTRL &= ~(PORT_INT0LVL_gm);                                // Shut down interrupts on PORTF
         PORTF_INTCTRL &= ~(PORT_INT0LVL_gm);                                // Shut down interrupts on PORTF
@@ -1533,6 +2251,9 @@ bool app_write_REG_EN_ENCODERS(void *a)
         }
     }
     
+    /* The encoder and a hardware mimic of port 2 share its IR channel */
+    mimic_hw_update(2, read_POKE2_IR);
+    
     app_regs.REG_EN_ENCODERS = reg;
 	return true;
 }
@@ -1552,46 +2273,222 @@ bool app_write_REG_CONF_ENCODERS(void *a)
 	return true;
 }
 /************************************************************************/
-/* REG_RESERVED2                                                        */
+/* REG_PROFILER_CTRL                                                    */
 /************************************************************************/
-void app_read_REG_RESERVED2(void) {}
-bool app_write_REG_RESERVED2(void *a) {return true;}
+profiler_probe_t profiler[PROFILER_PROBES];
+bool profiler_enabled = false;
+uint16_t profiler_nested = 0;
+
+/* TCE1 counts cycles for the profiler, or 8 cycles when it only measures the CPU load */
+static bool profiler_cycles = false;
+
+/* Cycles spent in application ISRs and in core callbacks, excluding preemption */
+uint32_t profiler_busy_isr = 0;
+uint32_t profiler_busy_callbacks = 0;
+
+void profiler_record(uint8_t probe, uint16_t t0, uint16_t n0)
+{
+	profiler_probe_t *p = &profiler[probe];
+	
+	uint8_t sreg = SREG;
+	cli();
+	
+	uint16_t cycles = TCE1_CNT - t0;
+	uint16_t preempted = profiler_nested - n0;
+	profiler_nested += cycles - preempted;
+	
+	if (probe >= PROFILER_T_1MS)
+		profiler_busy_callbacks += cycles - preempted;
+	else
+		profiler_busy_isr += cycles - preempted;
+	
+	if (!profiler_cycles)
+	{
+		SREG = sreg;
+		return;
+	}
+	
+	if (cycles < p->min) p->min = cycles;
+	if (cycles > p->max) p->max = cycles;
+	
+	/* Keep the mean on a sliding window instead of overflowing */
+	if (p->count == 0xFFFF)
+	{
+		p->sum >>= 1;
+		p->count >>= 1;
+	}
+	
+	p->sum += cycles;
+	p->count++;
+	
+	SREG = sreg;
+}
+
+static void profiler_reset(void)
+{
+	for (uint8_t i = 0; i < PROFILER_PROBES; i++)
+	{
+		profiler[i].min = 0xFFFF;
+		profiler[i].max = 0;
+		profiler[i].count = 0;
+		profiler[i].sum = 0;
+	}
+}
+
+static void profiler_read(uint16_t *reg, uint8_t first_probe, uint8_t n_probes)
+{
+	profiler_probe_t probe;
+	
+	for (uint8_t i = 0; i < n_probes; i++)
+	{
+		/* Take a consistent copy, the ISRs keep updating it */
+		uint8_t sreg = SREG;
+		cli();
+		probe = profiler[first_probe + i];
+		SREG = sreg;
+		
+		if (probe.count)
+		{
+			reg[i*3 + 0] = probe.min;
+			reg[i*3 + 1] = probe.sum / probe.count;
+			reg[i*3 + 2] = probe.max;
+		}
+		else
+		{
+			reg[i*3 + 0] = 0;
+			reg[i*3 + 1] = 0;
+			reg[i*3 + 2] = 0;
+		}
+	}
+}
+
+/* TCE1 runs at the CPU clock while the profiler is enabled. The CPU load alone   */
+/* is measured at DIV8, which keeps the 16 ms reach of the poke 0 and 1 captures. */
+void profiler_timer_update(void)
+{
+	bool cycles = app_regs.REG_PROFILER_CTRL & B_PROFILER_EN;
+	bool run = cycles || (app_regs.REG_EVNT_ENABLE & B_EVT_CPU_LOAD) || cpu_load_polled;
+	
+	if (run && (!profiler_enabled || cycles != profiler_cycles))
+	{
+		uint8_t sreg = SREG;
+		cli();
+		
+		profiler_reset();
+		profiler_nested = 0;
+		profiler_busy_isr = 0;
+		profiler_busy_callbacks = 0;
+		
+		/* The second the timer started in isn't whole */
+		cpu_load_partial = true;
+		
+		/* Free running, so one count is one cycle or eight */
+		if (cycles || TCE1_CTRLA != TC_CLKSEL_DIV8_gc)
+		{
+			TCE1_CTRLA = TC_CLKSEL_OFF_gc;
+			TCE1_CNT = 0;
+			TCE1_PER = 0xFFFF;
+			TCE1_CTRLA = cycles ? TC_CLKSEL_DIV1_gc : TC_CLKSEL_DIV8_gc;
+		}
+		
+		profiler_cycles = cycles;
+		profiler_enabled = true;
+		
+		SREG = sreg;
+	}
+	
+	if (!run && profiler_enabled)
+	{
+		profiler_enabled = false;
+		
+		/* Stops it or slows it down for the poke captures */
+		poke_capture_update();
+	}
+}
+
+void app_read_REG_PROFILER_CTRL(void) {}
+bool app_write_REG_PROFILER_CTRL(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(B_PROFILER_EN | B_PROFILER_RESET)) return false;
+	
+	if (reg & B_PROFILER_RESET)
+	{
+		uint8_t sreg = SREG;
+		cli();
+		profiler_reset();
+		SREG = sreg;
+	}
+	
+	app_regs.REG_PROFILER_CTRL = reg & B_PROFILER_EN;
+	
+	profiler_timer_update();
+	return true;
+}
+
 /************************************************************************/
-/* REG_RESERVED3                                                        */
+/* REG_PROFILER_POKES                                                   */
 /************************************************************************/
-void app_read_REG_RESERVED3(void) {}
-bool app_write_REG_RESERVED3(void *a) {return true;}
+void app_read_REG_PROFILER_POKES(void)
+{
+	profiler_read(app_regs.REG_PROFILER_POKES, PROFILER_POKE0_IR, 4);
+}
+bool app_write_REG_PROFILER_POKES(void *a) { return false; }
+
 /************************************************************************/
-/* REG_RESERVED4                                                        */
+/* REG_PROFILER_TIMERS_OVF                                              */
 /************************************************************************/
-void app_read_REG_RESERVED4(void) {}
-bool app_write_REG_RESERVED4(void *a) {return true;}
+void app_read_REG_PROFILER_TIMERS_OVF(void)
+{
+	profiler_read(app_regs.REG_PROFILER_TIMERS_OVF, PROFILER_TCF0_OVF, 4);
+}
+bool app_write_REG_PROFILER_TIMERS_OVF(void *a) { return false; }
+
 /************************************************************************/
-/* REG_RESERVED5                                                        */
+/* REG_PROFILER_TIMERS_CCA                                              */
 /************************************************************************/
-void app_read_REG_RESERVED5(void) {}
-bool app_write_REG_RESERVED5(void *a) {return true;}
+void app_read_REG_PROFILER_TIMERS_CCA(void)
+{
+	profiler_read(app_regs.REG_PROFILER_TIMERS_CCA, PROFILER_TCF0_CCA, 2);
+}
+bool app_write_REG_PROFILER_TIMERS_CCA(void *a) { return false; }
+
 /************************************************************************/
-/* REG_RESERVED6                                                        */
+/* REG_PROFILER_ADC                                                     */
 /************************************************************************/
-void app_read_REG_RESERVED6(void) {}
-bool app_write_REG_RESERVED6(void *a) {return true;}
+void app_read_REG_PROFILER_ADC(void)
+{
+	profiler_read(app_regs.REG_PROFILER_ADC, PROFILER_ADCA_CH0, 1);
+}
+bool app_write_REG_PROFILER_ADC(void *a) { return false; }
+
 /************************************************************************/
-/* REG_RESERVED7                                                        */
+/* REG_PROFILER_SERIAL_TSTAMP                                           */
 /************************************************************************/
-void app_read_REG_RESERVED7(void) {}
-bool app_write_REG_RESERVED7(void *a) {return true;}
+void app_read_REG_PROFILER_SERIAL_TSTAMP(void)
+{
+	profiler_read(app_regs.REG_PROFILER_SERIAL_TSTAMP, PROFILER_USARTF1_DRE, 1);
+}
+bool app_write_REG_PROFILER_SERIAL_TSTAMP(void *a) { return false; }
+
 /************************************************************************/
-/* REG_RESERVED8                                                        */
+/* REG_PROFILER_T_1MS                                                   */
 /************************************************************************/
-void app_read_REG_RESERVED8(void) {}
-bool app_write_REG_RESERVED8(void *a) {return true;}
+void app_read_REG_PROFILER_T_1MS(void)
+{
+	profiler_read(app_regs.REG_PROFILER_T_1MS, PROFILER_T_1MS, 1);
+}
+bool app_write_REG_PROFILER_T_1MS(void *a) { return false; }
 
 /************************************************************************/
-/* REG_RESERVED9                                                        */
+/* REG_PROFILER_T_500US                                                 */
 /************************************************************************/
-void app_read_REG_RESERVED9(void) {}
-bool app_write_REG_RESERVED9(void *a) {return true;}
+void app_read_REG_PROFILER_T_500US(void)
+{
+	profiler_read(app_regs.REG_PROFILER_T_500US, PROFILER_T_500US, 1);
+}
+bool app_write_REG_PROFILER_T_500US(void *a) { return false; }
 
 /************************************************************************/
 /* REG_CAM_OUT0_FRAME_ACQUIRED                                          */
@@ -1636,15 +2533,138 @@ bool app_write_REG_CAM_OUT1_FREQ(void *a)
 
 
 /************************************************************************/
-/* REG_RESERVED10                                                       */
+/* REG_TX_BUFFER_STATS                                                  */
 /************************************************************************/
-void app_read_REG_RESERVED10(void) {}
-bool app_write_REG_RESERVED10(void *a) {return true;}
+/* Write and read indexes of the core's TX buffer */
+extern uint16_t hwbp_uart_head;
+extern uint16_t hwbp_uart_tail;
+
+extern uint8_t app_regs_type[];
+extern uint16_t app_regs_n_elements[];
+
+uint16_t tx_buffer_high_water = 0;
+uint16_t tx_buffer_dropped = 0;
+
+static uint16_t tx_buffer_occupancy(void)
+{
+	uint16_t head, tail;
+	
+	uint8_t sreg = SREG;
+	cli();
+	head = hwbp_uart_head;
+	tail = hwbp_uart_tail;
+	SREG = sreg;
+	
+	return (head >= tail) ? head - tail : TX_BUFFER_SIZE - tail + head;
+}
+
+void tx_send_event(uint8_t add, bool use_core_timestamp)
+{
+	uint16_t length = HARP_MESSAGE_OVERHEAD + (app_regs_type[add-APP_REGS_ADD_MIN] & MSK_TYPE_LEN) * app_regs_n_elements[add-APP_REGS_ADD_MIN];
+	
+	/* The core overwrites the oldest bytes when the buffer is full, which corrupts the stream */
+	if (tx_buffer_occupancy() + length > TX_BUFFER_SIZE - 1)
+	{
+		if (tx_buffer_dropped < 0xFFFF)
+			tx_buffer_dropped++;
+		return;
+	}
+	
+	core_func_send_event(add, use_core_timestamp);
+	
+	uint16_t occupancy = tx_buffer_occupancy();
+	
+	if (occupancy > tx_buffer_high_water)
+		tx_buffer_high_water = occupancy;
+}
+
+void tx_send_event_at(uint8_t add, uint32_t second, uint16_t usecond)
+{
+	/* The ADC events marked the user timestamp before their conversion */
+	uint32_t user_second;
+	uint16_t user_usecond;
+	core_func_read_user_timestamp(&user_second, &user_usecond);
+	
+	core_func_update_user_timestamp(second, usecond);
+	tx_send_event(add, false);
+	
+	core_func_update_user_timestamp(user_second, user_usecond);
+}
+
+void app_read_REG_TX_BUFFER_STATS(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+	app_regs.REG_TX_BUFFER_STATS[0] = tx_buffer_high_water;
+	app_regs.REG_TX_BUFFER_STATS[1] = tx_buffer_dropped;
+	SREG = sreg;
+}
+
+bool app_write_REG_TX_BUFFER_STATS(void *a)
+{
+	/* Any write clears the statistics */
+	uint8_t sreg = SREG;
+	cli();
+	tx_buffer_high_water = 0;
+	tx_buffer_dropped = 0;
+	SREG = sreg;
+	
+	app_regs.REG_TX_BUFFER_STATS[0] = 0;
+	app_regs.REG_TX_BUFFER_STATS[1] = 0;
+	return true;
+}
 /************************************************************************/
-/* REG_RESERVED11                                                       */
+/* REG_CPU_LOAD                                                         */
 /************************************************************************/
-void app_read_REG_RESERVED11(void) {}
-bool app_write_REG_RESERVED11(void *a) {return true;}
+uint8_t cpu_load_polled = 0;
+bool cpu_load_partial = false;
+
+void cpu_load_update(void)
+{
+	uint32_t isr, callbacks;
+	bool partial;
+	
+	/* The measurement stops once the register hasn't been read for a while */
+	if (cpu_load_polled && !--cpu_load_polled)
+		profiler_timer_update();
+	
+	uint8_t sreg = SREG;
+	cli();
+	isr = profiler_busy_isr;
+	callbacks = profiler_busy_callbacks;
+	profiler_busy_isr = 0;
+	profiler_busy_callbacks = 0;
+	partial = cpu_load_partial;
+	cpu_load_partial = false;
+	SREG = sreg;
+	
+	if (!profiler_enabled || partial)
+	{
+		app_regs.REG_CPU_LOAD[0] = CPU_LOAD_UNKNOWN;
+		app_regs.REG_CPU_LOAD[1] = CPU_LOAD_UNKNOWN;
+		return;
+	}
+	
+	if (!profiler_cycles)
+	{
+		isr *= 8;
+		callbacks *= 8;
+	}
+	
+	/* In units of 0.01 %, out of the 32000000 cycles of one second */
+	app_regs.REG_CPU_LOAD[0] = (isr > 32000000) ? 10000 : isr / 3200;
+	app_regs.REG_CPU_LOAD[1] = (callbacks > 32000000) ? 10000 : callbacks / 3200;
+	
+	if (app_regs.REG_EVNT_ENABLE & B_EVT_CPU_LOAD)
+		tx_send_event(ADD_REG_CPU_LOAD, true);
+}
+
+void app_read_REG_CPU_LOAD(void)
+{
+	cpu_load_polled = CPU_LOAD_POLL_SECONDS;
+	profiler_timer_update();
+}
+bool app_write_REG_CPU_LOAD(void *a) { return false; }
 /************************************************************************/
 /* REG_RESERVED12                                                       */
 /************************************************************************/
@@ -1846,6 +2866,8 @@ void timestamp_tx_streaming(void)
 
 ISR(USARTF1_DRE_vect, ISR_NAKED)
 {
+	profiler_start();
+	
 	timestamp_tx_index++;
 	
 	USARTF1_DATA = *((uint8_t*)(&timestamp_tx) + timestamp_tx_index);
@@ -1854,6 +2876,8 @@ ISR(USARTF1_DRE_vect, ISR_NAKED)
 	{
 		USARTF1.CTRLA &= ~(USART_DREINTLVL_OFF_gc | USART_DREINTLVL_gm);
 	}
+	
+	profiler_stop(PROFILER_USARTF1_DRE);
 	reti();
 }
 
@@ -1876,6 +2900,7 @@ bool app_write_REG_MIMIC_PORT0_IR(void *a)
    uint8_t reg = *((uint8_t*)a);
    update_DIO_to_mimic(reg);
    app_regs.REG_MIMIC_PORT0_IR = reg;
+   mimic_hw_update(0, read_POKE0_IR);
    return true;
 }
 
@@ -1888,6 +2913,7 @@ bool app_write_REG_MIMIC_PORT1_IR(void *a)
    uint8_t reg = *((uint8_t*)a);
    update_DIO_to_mimic(reg);
    app_regs.REG_MIMIC_PORT1_IR = reg;
+   mimic_hw_update(1, read_POKE1_IR);
    return true;
 }
 
@@ -1900,6 +2926,7 @@ bool app_write_REG_MIMIC_PORT2_IR(void *a)
    uint8_t reg = *((uint8_t*)a);
    update_DIO_to_mimic(reg);
    app_regs.REG_MIMIC_PORT2_IR = reg;
+   mimic_hw_update(2, read_POKE2_IR);
    return true;
 }
    
@@ -1972,6 +2999,1950 @@ void app_read_REG_POKE_INPUT_FILTER_MS(void) {}
 bool app_write_REG_POKE_INPUT_FILTER_MS(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	/* Kept for compatibility, it sets both hold-offs of the pokes */
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		app_regs.REG_DI_DEBOUNCE_RISE[i] = (uint32_t)reg * 1000;
+		app_regs.REG_DI_DEBOUNCE_FALL[i] = (uint32_t)reg * 1000;
+	}
+	
 	app_regs.REG_POKE_INPUT_FILTER_MS = reg;	
 	return true;
-}
\ No newline at end of file
+}
+
+/************************************************************************/
+/* REG_PULSE_HIGH_RES                                                   */
+/************************************************************************/
+void app_read_REG_PULSE_HIGH_RES(void) {}
+bool app_write_REG_PULSE_HIGH_RES(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg & ~PULSE_HIGH_RES_MASK) return false;
+	
+	app_regs.REG_PULSE_HIGH_RES = reg;
+	
+	pulse_us_timer_update();
+	return true;
+}
+
+/************************************************************************/
+/* REG_TRAIN_WIDTH                                                      */
+/************************************************************************/
+void app_read_REG_TRAIN_WIDTH(void) {}
+bool app_write_REG_TRAIN_WIDTH(void *a)
+{
+	uint16_t * reg = ((uint16_t*)a);
+	
+	for (uint8_t i = 0; i < TRAIN_CHANNELS; i++)
+		if (reg[i] < 1)
+			return false;
+	
+	for (uint8_t i = 0; i < TRAIN_CHANNELS; i++)
+		app_regs.REG_TRAIN_WIDTH[i] = reg[i];
+	
+	return true;
+}
+
+/************************************************************************/
+/* REG_TRAIN_PERIOD                                                     */
+/************************************************************************/
+void app_read_REG_TRAIN_PERIOD(void) {}
+bool app_write_REG_TRAIN_PERIOD(void *a)
+{
+	uint16_t * reg = ((uint16_t*)a);
+	
+	for (uint8_t i = 0; i < TRAIN_CHANNELS; i++)
+		if (reg[i] < 2)
+			return false;
+	
+	for (uint8_t i = 0; i < TRAIN_CHANNELS; i++)
+		app_regs.REG_TRAIN_PERIOD[i] = reg[i];
+	
+	return true;
+}
+
+/************************************************************************/
+/* REG_TRAIN_COUNT                                                      */
+/************************************************************************/
+void app_read_REG_TRAIN_COUNT(void) {}
+bool app_write_REG_TRAIN_COUNT(void *a)
+{
+	uint16_t * reg = ((uint16_t*)a);
+	
+	for (uint8_t i = 0; i < TRAIN_CHANNELS; i++)
+		app_regs.REG_TRAIN_COUNT[i] = reg[i];
+	
+	return true;
+}
+
+/************************************************************************/
+/* REG_TRAIN_START                                                      */
+/************************************************************************/
+void app_read_REG_TRAIN_START(void)
+{
+	app_regs.REG_TRAIN_START = train_active;
+}
+
+bool app_write_REG_TRAIN_START(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg & ~TRAIN_MASK) return false;
+	
+	/* The width and period are checked together, since either can be written first */
+	for (uint8_t i = 0; i < TRAIN_CHANNELS; i++)
+	{
+		uint16_t bit = train_bit(train_channel[i]);
+		
+		if (!(reg & bit))
+			continue;
+		
+		if (app_regs.REG_TRAIN_PERIOD[i] <= app_regs.REG_TRAIN_WIDTH[i])
+			return false;
+		
+		/* Each part outlasts the expiry that starts the next one */
+		if ((app_regs.REG_PULSE_HIGH_RES & bit) && (app_regs.REG_TRAIN_WIDTH[i] < TRAIN_US_MIN || app_regs.REG_TRAIN_PERIOD[i] - app_regs.REG_TRAIN_WIDTH[i] < TRAIN_US_MIN))
+			return false;
+	}
+	
+	for (uint8_t i = 0; i < TRAIN_CHANNELS; i++)
+	{
+		uint8_t channel = train_channel[i];
+		uint16_t bit = train_bit(channel);
+		
+		if (!(reg & bit))
+			continue;
+		
+		uint8_t sreg = SREG;
+		cli();
+		
+		train_width[i] = app_regs.REG_TRAIN_WIDTH[i];
+		train_gap[i] = app_regs.REG_TRAIN_PERIOD[i] - app_regs.REG_TRAIN_WIDTH[i];
+		train_left[i] = app_regs.REG_TRAIN_COUNT[i];
+		
+		if (train_left[i]) train_endless &= ~bit; else train_endless |= bit;
+		
+		train_active |= bit;
+		
+		if (app_regs.REG_PULSE_HIGH_RES & bit)
+		{
+			train_us |= bit;
+			train_on |= bit;
+			train_set(channel);
+			pulse_schedule_us(channel, train_width[i]);
+		}
+		else
+		{
+			/* The first pulse starts on the next tick */
+			train_us &= ~bit;
+			train_on &= ~bit;
+			pulse_schedule(channel, 1);
+		}
+		
+		SREG = sreg;
+	}
+	
+	app_regs.REG_TRAIN_START = reg;
+	return true;
+}
+
+/************************************************************************/
+/* REG_TRAIN_STOP                                                       */
+/************************************************************************/
+void app_read_REG_TRAIN_STOP(void) {}
+bool app_write_REG_TRAIN_STOP(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg & ~TRAIN_MASK) return false;
+	
+	for (uint8_t i = 0; i < TRAIN_CHANNELS; i++)
+	{
+		uint8_t channel = train_channel[i];
+		uint16_t bit = train_bit(channel);
+		
+		if (!(reg & bit) || !(train_active & bit))
+			continue;
+		
+		uint8_t sreg = SREG;
+		cli();
+		train_active &= ~bit;
+		train_on &= ~bit;
+		pulse_schedule(channel, 0);
+		pulse_expire(channel);
+		SREG = sreg;
+	}
+	
+	app_regs.REG_TRAIN_STOP = reg;
+	return true;
+}
+
+/************************************************************************/
+/* REG_TRAIN_DONE                                                       */
+/************************************************************************/
+void app_read_REG_TRAIN_DONE(void) {}
+bool app_write_REG_TRAIN_DONE(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_SCHEDULE_ADD                                                     */
+/************************************************************************/
+void app_read_REG_SCHEDULE_ADD(void) {}
+bool app_write_REG_SCHEDULE_ADD(void *a)
+{
+	uint16_t * reg = ((uint16_t*)a);
+	scheduled_output_t entries[SCHEDULE_UPLOAD_ENTRIES];
+	uint8_t n_entries = 0;
+	
+	/* Each entry is second (low and high words), usecond, set, clear and toggle */
+	for (uint8_t i = 0; i < SCHEDULE_UPLOAD_ENTRIES; i++)
+	{
+		uint16_t * words = reg + i * SCHEDULE_ENTRY_WORDS;
+		scheduled_output_t * entry = &entries[n_entries];
+		
+		entry->second = ((uint32_t)words[1] << 16) | words[0];
+		entry->usecond = words[2];
+		entry->set = words[3];
+		entry->clear = words[4];
+		entry->toggle = words[5];
+		entry->pwm_start = 0;
+		entry->cameras_start = 0;
+		
+		/* Entries without operations pad the upload */
+		if (!(entry->set | entry->clear | entry->toggle))
+			continue;
+		
+		if (entry->usecond >= 31250) return false;
+		if ((entry->set | entry->clear | entry->toggle) & ~SCHEDULE_MASK) return false;
+		
+		n_entries++;
+	}
+	
+	/* The upload is taken whole or not at all */
+	if (n_entries > SCHEDULE_CAPACITY - schedule_queued)
+		return false;
+	
+	for (uint8_t i = 0; i < n_entries; i++)
+	{
+		uint8_t sreg = SREG;
+		cli();
+		schedule_insert(&entries[i]);
+		SREG = sreg;
+	}
+	
+	/* Loads CCB with the new head, or runs the entries already due */
+	timestamp_compare_service();
+	
+	for (uint8_t i = 0; i < SCHEDULE_UPLOAD_ENTRIES * SCHEDULE_ENTRY_WORDS; i++)
+		app_regs.REG_SCHEDULE_ADD[i] = reg[i];
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SCHEDULE_DEPTH                                                   */
+/************************************************************************/
+void app_read_REG_SCHEDULE_DEPTH(void)
+{
+	app_regs.REG_SCHEDULE_DEPTH = schedule_queued;
+}
+
+bool app_write_REG_SCHEDULE_DEPTH(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_SCHEDULE_FLUSH                                                   */
+/************************************************************************/
+void app_read_REG_SCHEDULE_FLUSH(void) {}
+bool app_write_REG_SCHEDULE_FLUSH(void *a)
+{
+	uint8_t sreg = SREG;
+	cli();
+	schedule_queued = 0;
+	SREG = sreg;
+	
+	/* CCB may still be needed by a hold-off */
+	timestamp_compare_service();
+	
+	app_regs.REG_SCHEDULE_FLUSH = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SCHEDULE_DONE                                                    */
+/************************************************************************/
+void app_read_REG_SCHEDULE_DONE(void) {}
+bool app_write_REG_SCHEDULE_DONE(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_TRANSACTION                                                      */
+/************************************************************************/
+/* Each entry is an address, its type and the register's whole payload, as in */
+/* a write message, and address 0 ends the list                               */
+static uint16_t transaction_entry_length(uint8_t * entry)
+{
+	return 2 + (entry[1] & MSK_TYPE_LEN) * app_regs_n_elements[entry[0] - APP_REGS_ADD_MIN];
+}
+
+/* Only quick writes, whose values are checked here before any is applied, join a transaction */
+static bool transaction_entry_allowed(uint8_t add, uint8_t * payload)
+{
+	uint16_t value = (app_regs_type[add - APP_REGS_ADD_MIN] == TYPE_U8) ? payload[0] : *((uint16_t*)payload);
+	
+	/* The RGBs are sent bit by bit to the WS2812, and REG_OUTPUTS_OUT may turn them off */
+	if (add >= ADD_REG_OUTPUTS_SET && add <= ADD_REG_OUTPUTS_TOGGLE)
+		return !(value & (B_RGB0 | B_RGB1));
+	
+	if (add >= ADD_REG_PORT_DIOS_SET && add <= ADD_REG_PORT_DIOS_OUT)
+		return true;
+	
+	if (add == ADD_REG_OUTPUT_PULSE_EN || add == ADD_REG_PWM_START || add == ADD_REG_PWM_STOP)
+		return true;
+	
+	if (add >= ADD_REG_PULSE_PORT0_DO && add <= ADD_REG_PULSE_DO3)
+		return value >= 1;
+	
+	if (add >= ADD_REG_FREQ_DO0 && add <= ADD_REG_FREQ_DO3)
+		return value >= 1 && value <= 10000;
+	
+	if (add >= ADD_REG_DCYCLE_DO0 && add <= ADD_REG_DCYCLE_DO3)
+		return value >= 1 && value <= 99;
+	
+	return false;
+}
+
+void app_read_REG_TRANSACTION(void) {}
+bool app_write_REG_TRANSACTION(void *a)
+{
+	uint8_t * reg = ((uint8_t*)a);
+	uint16_t end, i;
+	
+	for (end = 0; end < sizeof(app_regs.REG_TRANSACTION) && reg[end]; end += transaction_entry_length(&reg[end]))
+	{
+		uint8_t add = reg[end];
+		
+		if (end + 2 > sizeof(app_regs.REG_TRANSACTION)) return false;
+		if (add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX) return false;
+		if (app_regs_type[add - APP_REGS_ADD_MIN] != reg[end + 1]) return false;
+		if (end + transaction_entry_length(&reg[end]) > sizeof(app_regs.REG_TRANSACTION)) return false;
+		if (!transaction_entry_allowed(add, &reg[end + 2])) return false;
+	}
+	
+	/* No interrupt sees the registers halfway through, and every write was checked to be accepted */
+	uint8_t sreg = SREG;
+	cli();
+	
+	for (i = 0; i < end; i += transaction_entry_length(&reg[i]))
+		(*app_func_wr_pointer[reg[i] - APP_REGS_ADD_MIN])(&reg[i + 2]);
+	
+	SREG = sreg;
+	
+	for (i = 0; i < sizeof(app_regs.REG_TRANSACTION); i++)
+		app_regs.REG_TRANSACTION[i] = reg[i];
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_START_AT                                                         */
+/************************************************************************/
+void app_read_REG_START_AT(void) {}
+bool app_write_REG_START_AT(void *a)
+{
+	uint16_t * reg = ((uint16_t*)a);
+	scheduled_output_t entry;
+	
+	/* Second (low and high words), usecond, PWM_START and START_CAMERAS masks */
+	entry.second = ((uint32_t)reg[1] << 16) | reg[0];
+	entry.usecond = reg[2];
+	entry.set = entry.clear = entry.toggle = 0;
+	entry.pwm_start = reg[3];
+	entry.cameras_start = reg[4];
+	
+	if (entry.usecond >= 31250) return false;
+	if (reg[3] & ~(B_PWM_DO0 | B_PWM_DO1 | B_PWM_DO2 | B_PWM_DO3)) return false;
+	if (reg[4] & ~(B_EN_CAM_OUT0 | B_EN_CAM_OUT1)) return false;
+	if (!reg[3] && !reg[4]) return false;
+	
+	/* Camera 0 and 1 share DO0 and DO1 with their PWM */
+	if ((reg[3] & B_PWM_DO0) && (reg[4] & B_EN_CAM_OUT0)) return false;
+	if ((reg[3] & B_PWM_DO1) && (reg[4] & B_EN_CAM_OUT1)) return false;
+	
+	if (schedule_queued == SCHEDULE_CAPACITY)
+		return false;
+	
+	/* The camera outputs stay low until the start, so it needs no settling delay */
+	if ((reg[4] & B_EN_CAM_OUT0) && !_states_.camera.do0) clr_DO0;
+	if ((reg[4] & B_EN_CAM_OUT1) && !_states_.camera.do1) clr_DO1;
+	
+	uint8_t sreg = SREG;
+	cli();
+	schedule_insert(&entry);
+	SREG = sreg;
+	
+	timestamp_compare_service();
+	
+	for (uint8_t i = 0; i < 5; i++)
+		app_regs.REG_START_AT[i] = reg[i];
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PWM_START_SYNC                                                   */
+/************************************************************************/
+/* The synchronized timers are loaded with the channel off, which also     */
+/* holds the ones already running, and all released on the same edge when */
+/* it's set again.                                                        */
+void app_read_REG_PWM_START_SYNC(void)
+{
+	app_regs.REG_PWM_START_SYNC = 0;
+	
+	for (uint8_t i = 0; i < 4; i++)
+		if (pwm_timer[i]->CTRLA == TC_CLKSEL_EVCH1_gc)
+			app_regs.REG_PWM_START_SYNC |= (1 << i);
+}
+
+bool app_write_REG_PWM_START_SYNC(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	uint8_t prescaler[4] = {timer_conf.prescaler_do0, timer_conf.prescaler_do1, timer_conf.prescaler_do2, timer_conf.prescaler_do3};
+	uint16_t target[4] = {timer_conf.target_do0, timer_conf.target_do1, timer_conf.target_do2, timer_conf.target_do3};
+	uint16_t dcycle[4] = {timer_conf.dcycle_do0, timer_conf.dcycle_do1, timer_conf.dcycle_do2, timer_conf.dcycle_do3};
+	bool running[4] = {_states_.pwm.do0, _states_.pwm.do1, _states_.pwm.do2, _states_.pwm.do3};
+	uint8_t start = 0, clock = 0;
+	
+	if (reg & ~(B_PWM_DO0 | B_PWM_DO1 | B_PWM_DO2 | B_PWM_DO3))
+		return false;
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if ((reg & (1 << i)) && !running[i])
+			start |= (1 << i);
+	}
+	
+	/* The channel carries a single clock, shared with the outputs it already runs */
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (!(start & (1 << i)) && pwm_timer[i]->CTRLA != TC_CLKSEL_EVCH1_gc)
+			continue;
+		
+		uint8_t source = pwm_event_source(prescaler[i]);
+		
+		if (clock && source != clock)
+			return false;
+		
+		clock = source;
+	}
+	
+	uint8_t sreg = SREG;
+	cli();
+	
+	EVSYS_CH1MUX = EVSYS_CHMUX_OFF_gc;
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (!(start & (1 << i)))
+			continue;
+		
+		timer_type0_pwm(pwm_timer[i], TC_CLKSEL_EVCH1_gc, target[i], dcycle[i], INT_LEVEL_LOW, INT_LEVEL_OFF);
+		
+		/* The output rises when the count wraps, the phase delays the wrap */
+		pwm_timer[i]->CNT = target[i] - 1 - (uint16_t)(((uint32_t)target[i] * app_regs.REG_PWM_PHASE[i]) / 100);
+	}
+	
+	if (clock)
+		EVSYS_CH1MUX = clock;
+	
+	SREG = sreg;
+	
+	if (start & B_PWM_DO0) { is_new_timer_conf.pwm_do0 = false; _states_.pwm.do0 = true; start_DO0; }
+	if (start & B_PWM_DO1) { is_new_timer_conf.pwm_do1 = false; _states_.pwm.do1 = true; start_DO1; }
+	if (start & B_PWM_DO2) { is_new_timer_conf.pwm_do2 = false; _states_.pwm.do2 = true; start_DO2; }
+	if (start & B_PWM_DO3) { is_new_timer_conf.pwm_do3 = false; _states_.pwm.do3 = true; start_DO3; }
+	
+	app_regs.REG_PWM_START_SYNC = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PWM_PHASE                                                        */
+/************************************************************************/
+void app_read_REG_PWM_PHASE(void) {}
+bool app_write_REG_PWM_PHASE(void *a)
+{
+	uint8_t * reg = ((uint8_t*)a);
+	
+	for (uint8_t i = 0; i < 4; i++)
+		if (reg[i] > 99)
+			return false;
+	
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_PWM_PHASE[i] = reg[i];
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CHIRP_FREQ_START                                                 */
+/************************************************************************/
+static bool chirp_freq_is_valid(uint16_t * freq)
+{
+	for (uint8_t i = 0; i < 4; i++)
+		if (freq[i] < 1 || freq[i] > 10000)
+			return false;
+	
+	return true;
+}
+
+void app_read_REG_CHIRP_FREQ_START(void) {}
+bool app_write_REG_CHIRP_FREQ_START(void *a)
+{
+	uint16_t * reg = ((uint16_t*)a);
+	
+	if (!chirp_freq_is_valid(reg))
+		return false;
+	
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_CHIRP_FREQ_START[i] = reg[i];
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CHIRP_FREQ_END                                                   */
+/************************************************************************/
+void app_read_REG_CHIRP_FREQ_END(void) {}
+bool app_write_REG_CHIRP_FREQ_END(void *a)
+{
+	uint16_t * reg = ((uint16_t*)a);
+	
+	if (!chirp_freq_is_valid(reg))
+		return false;
+	
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_CHIRP_FREQ_END[i] = reg[i];
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CHIRP_DURATION                                                   */
+/************************************************************************/
+void app_read_REG_CHIRP_DURATION(void) {}
+bool app_write_REG_CHIRP_DURATION(void *a)
+{
+	uint16_t * reg = ((uint16_t*)a);
+	
+	for (uint8_t i = 0; i < 4; i++)
+		if (reg[i] < 10)
+			return false;
+	
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_CHIRP_DURATION[i] = reg[i];
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CHIRP_SHAPE                                                      */
+/************************************************************************/
+void app_read_REG_CHIRP_SHAPE(void) {}
+bool app_write_REG_CHIRP_SHAPE(void *a)
+{
+	uint8_t * reg = ((uint8_t*)a);
+	
+	for (uint8_t i = 0; i < 4; i++)
+		if (reg[i] & ~MSK_CHIRP_SHAPE)
+			return false;
+	
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_CHIRP_SHAPE[i] = reg[i];
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CHIRP_START                                                      */
+/************************************************************************/
+void app_read_REG_CHIRP_START(void)
+{
+	app_regs.REG_CHIRP_START = pwm_chirp_active;
+}
+
+bool app_write_REG_CHIRP_START(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(B_PWM_DO0 | B_PWM_DO1 | B_PWM_DO2 | B_PWM_DO3))
+		return false;
+	
+	/* The prescaler only grows as the frequency falls, so the ends bound the chirp */
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (!(reg & (1 << i)))
+			continue;
+		
+		if (!pwm_sync_allows(i, pwm_freq_prescaler((uint32_t)app_regs.REG_CHIRP_FREQ_START[i] << 16)) ||
+			!pwm_sync_allows(i, pwm_freq_prescaler((uint32_t)app_regs.REG_CHIRP_FREQ_END[i] << 16)))
+			return false;
+	}
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		uint8_t bit = 1 << i;
+		
+		if (!(reg & bit))
+			continue;
+		
+		uint16_t start = app_regs.REG_CHIRP_FREQ_START[i];
+		uint16_t end = app_regs.REG_CHIRP_FREQ_END[i];
+		uint16_t duration = app_regs.REG_CHIRP_DURATION[i];
+		
+		pwm_chirp_cancel(bit);
+		
+		/* Steps once per millisecond, the last step lands on the end frequency */
+		chirp_freq[i] = (uint32_t)start << 16;
+		chirp_end[i] = (uint32_t)end << 16;
+		chirp_left[i] = duration;
+		chirp_step[i] = (((int32_t)end - start) << 16) / duration;
+		
+		/* Computed once per chirp, each step is then a single multiplication */
+		chirp_ratio[i] = (uint32_t)(exp(log((float)end / start) / duration) * 16777216.0 + 0.5);
+		
+		if ((app_regs.REG_CHIRP_SHAPE[i] & MSK_CHIRP_SHAPE) == GM_CHIRP_EXPONENTIAL)
+			chirp_exponential |= bit;
+		else
+			chirp_exponential &= ~bit;
+		
+		chirp_conf(i, chirp_freq[i]);
+	}
+	
+	/* Outputs not running yet start at the start frequency */
+	app_write_REG_PWM_START(&reg);
+	
+	uint8_t sreg = SREG;
+	cli();
+	pwm_chirp_active |= reg;
+	SREG = sreg;
+	
+	app_regs.REG_CHIRP_START = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* LED current waveforms                                                */
+/************************************************************************/
+uint8_t waveform_armed = 0;
+
+static uint8_t waveform_playing = 0;
+static uint8_t waveform_ending = 0;
+static uint16_t waveform[WAVEFORM_CAPACITY];
+
+/* Right shifts of the 32 MHz clock for each prescaler, DIV1 to DIV1024 */
+static const uint8_t waveform_clock_shift[] = {0, 1, 2, 3, 6, 8, 10};
+
+static void waveform_dma_conf(DMA_CH_t * channel, volatile void * dac_data)
+{
+	uintptr_t source = (uintptr_t)waveform;
+	uintptr_t destination = (uintptr_t)dac_data;
+	
+	channel->CTRLA = 0;
+	
+	/* One 2-byte burst per event, the table is read again on every repetition */
+	channel->ADDRCTRL = DMA_CH_SRCRELOAD_BLOCK_gc | DMA_CH_SRCDIR_INC_gc | DMA_CH_DESTRELOAD_BURST_gc | DMA_CH_DESTDIR_INC_gc;
+	channel->TRIGSRC = DMA_CH_TRIGSRC_EVSYS_CH2_gc;
+	channel->TRFCNT = app_regs.REG_WAVEFORM_LENGTH * 2;
+	channel->REPCNT = app_regs.REG_WAVEFORM_REPEAT;
+	
+	channel->SRCADDR0 = source;
+	channel->SRCADDR1 = source >> 8;
+	channel->SRCADDR2 = 0;
+	channel->DESTADDR0 = destination;
+	channel->DESTADDR1 = destination >> 8;
+	channel->DESTADDR2 = 0;
+	
+	/* A repetition count of 0 repeats forever and never completes */
+	channel->CTRLB = DMA_CH_TRNIF_bm | DMA_CH_ERRIF_bm | DMA_CH_TRNINTLVL_LO_gc;
+	channel->CTRLA = DMA_CH_ENABLE_bm | DMA_CH_REPEAT_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_2BYTE_gc;
+}
+
+static void waveform_restore_current(uint8_t mask)
+{
+	if (mask & B_WAVEFORM_LED0)
+		app_write_REG_LED0_CURRENT(&app_regs.REG_LED0_CURRENT);
+	
+	if (mask & B_WAVEFORM_LED1)
+		app_write_REG_LED1_CURRENT(&app_regs.REG_LED1_CURRENT);
+}
+
+static void waveform_timer_stop(void)
+{
+	TCD1_CTRLA = TC_CLKSEL_OFF_gc;
+	TCD1_CTRLFSET = TC_CMD_RESET_gc;
+	TCD1_INTCTRLA = TC_OVFINTLVL_OFF_gc;
+}
+
+/* Highest sample allowed by REG_LEDx_MAX_CURRENT on the selected LEDs */
+static uint16_t waveform_max_sample(uint8_t mask)
+{
+	uint16_t max = 4095;
+	uint16_t dac;
+	
+	if (mask & B_WAVEFORM_LED0)
+	{
+		dac = (uint32_t)app_regs.REG_LED0_MAX_CURRENT * 4096 / 100;
+		if (dac < max) max = dac;
+	}
+	
+	if (mask & B_WAVEFORM_LED1)
+	{
+		dac = (uint32_t)app_regs.REG_LED1_MAX_CURRENT * 4096 / 100;
+		if (dac < max) max = dac;
+	}
+	
+	return max;
+}
+
+/* Must be called with interrupts disabled */
+static void waveform_play(uint8_t mask)
+{
+	if (mask & B_WAVEFORM_LED0)
+		waveform_dma_conf(&DMA.CH0, &DACB_CH1DATA);
+	
+	if (mask & B_WAVEFORM_LED1)
+		waveform_dma_conf(&DMA.CH1, &DACB_CH0DATA);
+	
+	/* A waveform started during another one follows the sample clock already running */
+	if (!waveform_playing)
+	{
+		uint16_t rate = app_regs.REG_WAVEFORM_RATE;
+		uint8_t i = 0;
+		
+		while (((32000000UL >> waveform_clock_shift[i]) + rate / 2) / rate > 65536)
+			i++;
+		
+		DMA_CTRL = DMA_ENABLE_bm;
+		EVSYS_CH2MUX = EVSYS_CHMUX_TCD1_OVF_gc;
+		
+		waveform_timer_stop();
+		TCD1_PER = ((32000000UL >> waveform_clock_shift[i]) + rate / 2) / rate - 1;
+		TCD1_CTRLA = i + 1;
+	}
+	
+	waveform_playing |= mask;
+	waveform_ending &= ~mask;
+	waveform_armed &= ~mask;
+}
+
+void waveform_trigger(uint8_t inputs)
+{
+	if (!(app_regs.REG_WAVEFORM_TRIGGER & inputs))
+		return;
+	
+	uint8_t sreg = SREG;
+	cli();
+	waveform_play(waveform_armed);
+	SREG = sreg;
+}
+
+void waveform_finished(uint8_t mask)
+{
+	/* The last sample still lasts a whole period before the current is restored */
+	waveform_ending |= mask;
+	TCD1_INTFLAGS = TC1_OVFIF_bm;
+	TCD1_INTCTRLA = TC_OVFINTLVL_LO_gc;
+}
+
+void waveform_end(void)
+{
+	uint8_t ended = waveform_ending;
+	
+	waveform_ending = 0;
+	waveform_playing &= ~ended;
+	
+	if (!waveform_playing)
+		waveform_timer_stop();
+	else
+		TCD1_INTCTRLA = TC_OVFINTLVL_OFF_gc;
+	
+	/* REG_WAVEFORM_STOP came first */
+	if (!ended)
+		return;
+	
+	waveform_restore_current(ended);
+	
+	app_regs.REG_WAVEFORM_DONE = ended;
+	
+	if (app_regs.REG_EVNT_ENABLE_EXT & B_EVT_WAVEFORM_DONE)
+		tx_send_event(ADD_REG_WAVEFORM_DONE, true);
+}
+
+void waveform_stop(uint8_t mask)
+{
+	uint8_t sreg = SREG;
+	cli();
+	
+	uint8_t stopped = mask & waveform_playing;
+	
+	if (stopped & B_WAVEFORM_LED0)
+		DMA.CH0.CTRLA = 0;
+	
+	if (stopped & B_WAVEFORM_LED1)
+		DMA.CH1.CTRLA = 0;
+	
+	waveform_armed &= ~mask;
+	waveform_playing &= ~mask;
+	waveform_ending &= ~mask;
+	
+	if (!waveform_playing)
+		waveform_timer_stop();
+	
+	waveform_restore_current(stopped);
+	
+	SREG = sreg;
+}
+
+
+/************************************************************************/
+/* REG_WAVEFORM_DATA                                                    */
+/************************************************************************/
+void app_read_REG_WAVEFORM_DATA(void)
+{
+	uint16_t index = app_regs.REG_WAVEFORM_DATA[0];
+	
+	for (uint8_t i = 0; i < WAVEFORM_UPLOAD_SAMPLES; i++)
+		app_regs.REG_WAVEFORM_DATA[i + 1] = waveform[index + i];
+}
+
+bool app_write_REG_WAVEFORM_DATA(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	uint16_t index = reg[0];
+	
+	if (index > WAVEFORM_CAPACITY - WAVEFORM_UPLOAD_SAMPLES)
+		return false;
+	
+	uint16_t max = waveform_max_sample(waveform_playing | waveform_armed);
+	
+	for (uint8_t i = 1; i <= WAVEFORM_UPLOAD_SAMPLES; i++)
+		if (reg[i] > max)
+			return false;
+	
+	/* A table being played changes from the next sample on */
+	for (uint8_t i = 0; i < WAVEFORM_UPLOAD_SAMPLES; i++)
+		waveform[index + i] = reg[i + 1];
+
+	for (uint8_t i = 0; i <= WAVEFORM_UPLOAD_SAMPLES; i++)
+		app_regs.REG_WAVEFORM_DATA[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_WAVEFORM_LENGTH                                                  */
+/************************************************************************/
+void app_read_REG_WAVEFORM_LENGTH(void) {}
+bool app_write_REG_WAVEFORM_LENGTH(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg < 1 || reg > WAVEFORM_CAPACITY)
+		return false;
+
+	app_regs.REG_WAVEFORM_LENGTH = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_WAVEFORM_RATE                                                    */
+/************************************************************************/
+void app_read_REG_WAVEFORM_RATE(void) {}
+bool app_write_REG_WAVEFORM_RATE(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg < 1 || reg > 50000)
+		return false;
+
+	app_regs.REG_WAVEFORM_RATE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_WAVEFORM_REPEAT                                                  */
+/************************************************************************/
+void app_read_REG_WAVEFORM_REPEAT(void) {}
+bool app_write_REG_WAVEFORM_REPEAT(void *a)
+{
+	app_regs.REG_WAVEFORM_REPEAT = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_WAVEFORM_TRIGGER                                                 */
+/************************************************************************/
+void app_read_REG_WAVEFORM_TRIGGER(void) {}
+bool app_write_REG_WAVEFORM_TRIGGER(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(B_DI0 | B_DI1 | B_DI2))
+		return false;
+
+	app_regs.REG_WAVEFORM_TRIGGER = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_WAVEFORM_START                                                   */
+/************************************************************************/
+void app_read_REG_WAVEFORM_START(void)
+{
+	app_regs.REG_WAVEFORM_START = waveform_playing | waveform_armed;
+}
+
+bool app_write_REG_WAVEFORM_START(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~WAVEFORM_MASK)
+		return false;
+	
+	/* TCD1 is counting the encoder */
+	if (_states_.quad_counter.port2)
+		return false;
+	
+	uint16_t max = waveform_max_sample(reg);
+	
+	for (uint16_t i = 0; i < app_regs.REG_WAVEFORM_LENGTH; i++)
+		if (waveform[i] > max)
+			return false;
+	
+	/* A waveform already playing starts over */
+	waveform_stop(reg);
+	
+	uint8_t sreg = SREG;
+	cli();
+	
+	if (app_regs.REG_WAVEFORM_TRIGGER)
+		waveform_armed |= reg;
+	else
+		waveform_play(reg);
+	
+	SREG = sreg;
+
+	app_regs.REG_WAVEFORM_START = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_WAVEFORM_STOP                                                    */
+/************************************************************************/
+void app_read_REG_WAVEFORM_STOP(void) {}
+bool app_write_REG_WAVEFORM_STOP(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~WAVEFORM_MASK)
+		return false;
+	
+	waveform_stop(reg);
+
+	app_regs.REG_WAVEFORM_STOP = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_WAVEFORM_DONE                                                    */
+/************************************************************************/
+void app_read_REG_WAVEFORM_DONE(void) {}
+bool app_write_REG_WAVEFORM_DONE(void *a) { return false; }
+
+
+/************************************************************************/
+/* PWM extended range                                                   */
+/************************************************************************/
+/* The timer prescalers cover down to 0.48 Hz with at least 8192 counts of */
+/* period. Below that, the outputs count event channel 3, which carries the */
+/* peripheral clock divided by 32768 and is shared by all of them.          */
+static uint8_t pwm_period_shift(uint8_t i)
+{
+	return (i < 7) ? pwm_clock_shift[i] - 7 : 15;
+}
+
+/* Index of the finest prescaler whose period still fits the counter, 7 is event channel 3 */
+static uint8_t pwm_period_index(uint32_t ticks)
+{
+	uint8_t i = 0;
+	
+	while (((ticks + ((1UL << pwm_period_shift(i)) >> 1)) >> pwm_period_shift(i)) > 65535)
+		i++;
+	
+	return i;
+}
+
+/* Rounds the 32 MHz clock in mHz over a divisor below 2^31. The clock is */
+/* 4000000000 times 8, so the last three quotient bits come from a long   */
+/* division of the remainder and everything stays in 32 bits.             */
+static uint32_t pwm_clock_mhz_over(uint32_t divisor)
+{
+	uint32_t quotient = 4000000000UL / divisor;
+	uint32_t remainder = 4000000000UL % divisor;
+	
+	for (uint8_t bit = 0; bit < 3; bit++)
+	{
+		quotient <<= 1;
+		remainder <<= 1;
+		
+		if (remainder >= divisor)
+		{
+			remainder -= divisor;
+			quotient++;
+		}
+	}
+	
+	return (remainder >= divisor - remainder) ? quotient + 1 : quotient;
+}
+
+/* Counts of the undivided clock in one period, at most 2^31 at 15 mHz */
+static uint32_t pwm_period_ticks(uint32_t freq_mhz)
+{
+	return pwm_clock_mhz_over(freq_mhz);
+}
+
+static uint8_t pwm_period_prescaler(uint32_t freq_mhz)
+{
+	uint8_t i = pwm_period_index(pwm_period_ticks(freq_mhz));
+	
+	return (i < 7) ? i + 1 : TC_CLKSEL_EVCH3_gc;
+}
+
+static void pwm_conf_period(uint32_t freq_mhz, uint16_t fraction, uint8_t * prescaler, uint16_t * target, uint16_t * dcycle_count, bool * is_new)
+{
+	uint32_t ticks = pwm_period_ticks(freq_mhz);
+	uint8_t i = pwm_period_index(ticks);
+	uint8_t shift = pwm_period_shift(i);
+	
+	uint16_t period = (ticks + ((1UL << shift) >> 1)) >> shift;
+	uint16_t count = pwm_dcycle_count(period, fraction);
+	
+	if (i == 7)
+		EVSYS_CH3MUX = EVSYS_CHMUX_PRESCALER_32768_gc;
+	
+	uint8_t sreg = SREG;
+	cli();
+	*prescaler = (i < 7) ? i + 1 : TC_CLKSEL_EVCH3_gc;
+	*target = period;
+	*dcycle_count = count;
+	*is_new = true;
+	SREG = sreg;
+}
+
+/* Frequency the timer configuration produces, in mHz */
+static uint32_t pwm_conf_mhz(uint8_t prescaler, uint16_t target)
+{
+	uint8_t shift;
+	
+	if (prescaler == TC_CLKSEL_EVCH3_gc)
+		shift = 15;
+	else if (prescaler)
+		shift = pwm_clock_shift[prescaler - 1] - 7;
+	else
+		return 0;
+	
+	return pwm_clock_mhz_over((uint32_t)target << shift);
+}
+
+
+/************************************************************************/
+/* REG_PWM_FREQ_FINE                                                    */
+/************************************************************************/
+void app_read_REG_PWM_FREQ_FINE(void)
+{
+	app_regs.REG_PWM_FREQ_FINE[0] = pwm_conf_mhz(timer_conf.prescaler_do0, timer_conf.target_do0);
+	app_regs.REG_PWM_FREQ_FINE[1] = pwm_conf_mhz(timer_conf.prescaler_do1, timer_conf.target_do1);
+	app_regs.REG_PWM_FREQ_FINE[2] = pwm_conf_mhz(timer_conf.prescaler_do2, timer_conf.target_do2);
+	app_regs.REG_PWM_FREQ_FINE[3] = pwm_conf_mhz(timer_conf.prescaler_do3, timer_conf.target_do3);
+}
+
+bool app_write_REG_PWM_FREQ_FINE(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+	
+	for (uint8_t i = 0; i < 4; i++)
+		if (reg[i] < 15 || reg[i] > 50000000)
+			return false;
+	
+	/* The synchronized outputs keep sharing one clock, which follows them */
+	uint8_t clock = 0;
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (!pwm_is_synced(i))
+			continue;
+		
+		uint8_t source = pwm_event_source(pwm_period_prescaler(reg[i]));
+		
+		if (clock && source != clock)
+			return false;
+		
+		clock = source;
+	}
+	
+	if (clock)
+		EVSYS_CH1MUX = clock;
+	
+	pwm_chirp_cancel(B_PWM_DO0 | B_PWM_DO1 | B_PWM_DO2 | B_PWM_DO3);
+	
+	pwm_conf_period(reg[0], pwm_dcycle_fraction[0], &timer_conf.prescaler_do0, &timer_conf.target_do0, &timer_conf.dcycle_do0, &is_new_timer_conf.pwm_do0);
+	pwm_conf_period(reg[1], pwm_dcycle_fraction[1], &timer_conf.prescaler_do1, &timer_conf.target_do1, &timer_conf.dcycle_do1, &is_new_timer_conf.pwm_do1);
+	pwm_conf_period(reg[2], pwm_dcycle_fraction[2], &timer_conf.prescaler_do2, &timer_conf.target_do2, &timer_conf.dcycle_do2, &is_new_timer_conf.pwm_do2);
+	pwm_conf_period(reg[3], pwm_dcycle_fraction[3], &timer_conf.prescaler_do3, &timer_conf.target_do3, &timer_conf.dcycle_do3, &is_new_timer_conf.pwm_do3);
+
+	/* PwmFrequency follows to the nearest Hz, reading 0 below 0.5 Hz */
+	app_regs.REG_FREQ_DO0 = (reg[0] + 500) / 1000;
+	app_regs.REG_FREQ_DO1 = (reg[1] + 500) / 1000;
+	app_regs.REG_FREQ_DO2 = (reg[2] + 500) / 1000;
+	app_regs.REG_FREQ_DO3 = (reg[3] + 500) / 1000;
+	
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_PWM_FREQ_FINE[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PWM_DCYCLE_FINE                                                  */
+/************************************************************************/
+void app_read_REG_PWM_DCYCLE_FINE(void) {}
+bool app_write_REG_PWM_DCYCLE_FINE(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	
+	for (uint8_t i = 0; i < 4; i++)
+		if (reg[i] < 1 || reg[i] > 9999)
+			return false;
+	
+	for (uint8_t i = 0; i < 4; i++)
+		pwm_dcycle_fraction[i] = ((uint32_t)reg[i] * 65536 + 5000) / 10000;
+	
+	pwm_conf_dcycle(pwm_dcycle_fraction[0], timer_conf.target_do0, &timer_conf.dcycle_do0, &is_new_timer_conf.pwm_do0);
+	pwm_conf_dcycle(pwm_dcycle_fraction[1], timer_conf.target_do1, &timer_conf.dcycle_do1, &is_new_timer_conf.pwm_do1);
+	pwm_conf_dcycle(pwm_dcycle_fraction[2], timer_conf.target_do2, &timer_conf.dcycle_do2, &is_new_timer_conf.pwm_do2);
+	pwm_conf_dcycle(pwm_dcycle_fraction[3], timer_conf.target_do3, &timer_conf.dcycle_do3, &is_new_timer_conf.pwm_do3);
+
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_PWM_DCYCLE_FINE[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* Poke edge capture                                                    */
+/************************************************************************/
+/* Time of the last captured edge of each poke */
+static uint32_t poke_edge_second[3];
+static uint16_t poke_edge_usecond[3];
+static bool poke_edge_captured[3];
+
+/* Edges read by the last entry of the poke's ISR, in us for the edge FIFO */
+static uint8_t poke_captures[3];
+static uint32_t poke_capture_us[3][2];
+
+void poke_capture(uint8_t poke)
+{
+	uint16_t latched[2];
+	uint8_t n = 0;
+	uint16_t cnt;
+	uint8_t shift;
+	
+	/* The profiler reads TCE1 from nested interrupts and TEMP is shared */
+	uint8_t sreg = SREG;
+	cli();
+	
+	/* Reading a capture clears its flag and moves the buffered one up. The */
+	/* last one is the edge that set the input's current state.             */
+	switch (poke)
+	{
+		case 0:
+			while (n < 2 && (TCE1_INTFLAGS & TC1_CCAIF_bm))
+				latched[n++] = TCE1_CCA;
+			cnt = TCE1_CNT;
+			shift = (TCE1_CTRLA == TC_CLKSEL_DIV1_gc) ? 10 : 7;
+			break;
+		
+		case 1:
+			while (n < 2 && (TCE1_INTFLAGS & TC1_CCBIF_bm))
+				latched[n++] = TCE1_CCB;
+			cnt = TCE1_CNT;
+			shift = (TCE1_CTRLA == TC_CLKSEL_DIV1_gc) ? 10 : 7;
+			break;
+		
+		default:
+			while (n < 2 && (TCF1_INTFLAGS & TC1_CCBIF_bm))
+				latched[n++] = TCF1_CCB;
+			cnt = TCF1_CNT;
+			shift = 7;
+			break;
+	}
+	
+	poke_captures[poke] = 0;
+	
+	/* An entry without a capture keeps the last one, which a held off edge reports later */
+	if (!(app_regs.REG_POKE_CAPTURE & (1 << poke)))
+	{
+		poke_edge_captured[poke] = false;
+	}
+	else if (n)
+	{
+		uint32_t second;
+		uint16_t usecond;
+		timestamp_now(&second, &usecond);
+		
+		/* 32 counts per us at the CPU clock, 4 at DIV8 */
+		uint32_t now_us = (second * 31250 + usecond) * 32;
+		
+		for (uint8_t i = 0; i < n; i++)
+			poke_capture_us[poke][i] = now_us - ((uint16_t)(cnt - latched[i]) >> (shift - 5));
+		
+		poke_captures[poke] = n;
+		
+		/* The latency in 32 us, 1024 counts at the CPU clock or 128 at DIV8 */
+		uint16_t latency = ((uint16_t)(cnt - latched[n - 1]) + (1 << (shift - 1))) >> shift;
+		
+		if (usecond < latency)
+		{
+			second--;
+			usecond += 31250;
+		}
+		
+		poke_edge_second[poke] = second;
+		poke_edge_usecond[poke] = usecond - latency;
+		poke_edge_captured[poke] = true;
+	}
+	
+	SREG = sreg;
+}
+
+void poke_send_event(uint8_t poke)
+{
+	if (!poke_edge_captured[poke])
+	{
+		tx_send_event(ADD_REG_PORT_DIS, true);
+		return;
+	}
+	
+	tx_send_event_at(ADD_REG_PORT_DIS, poke_edge_second[poke], poke_edge_usecond[poke]);
+}
+
+void poke_capture_update(void)
+{
+	uint8_t capture = app_regs.REG_POKE_CAPTURE;
+	
+	EVSYS_CH4MUX = EVSYS_CHMUX_PORTD_PIN4_gc;
+	EVSYS_CH5MUX = EVSYS_CHMUX_PORTE_PIN4_gc;
+	EVSYS_CH7MUX = EVSYS_CHMUX_PORTF_PIN4_gc;
+	
+	TCE1_CTRLD = TC_EVACT_CAPT_gc | TC_EVSEL_CH4_gc;
+	TCE1_CTRLB = ((capture & B_DI0) ? TC1_CCAEN_bm : 0) | ((capture & B_DI1) ? TC1_CCBEN_bm : 0);
+	
+	/* Channel 6 is left to CCA, which isn't enabled and stays the pulses' compare */
+	TCF1_CTRLD = TC_EVACT_CAPT_gc | TC_EVSEL_CH6_gc;
+	TCF1_CTRLB = (capture & B_DI2) ? TC1_CCBEN_bm : 0;
+	
+	/* Without the profiler, TCE1 counts at DIV8 to reach 16 ms back like TCF1 */
+	if (!profiler_enabled)
+	{
+		if (!(capture & (B_DI0 | B_DI1)))
+		{
+			TCE1_CTRLA = TC_CLKSEL_OFF_gc;
+		}
+		else if (TCE1_CTRLA != TC_CLKSEL_DIV8_gc)
+		{
+			TCE1_CTRLA = TC_CLKSEL_OFF_gc;
+			TCE1_CNT = 0;
+			TCE1_PER = 0xFFFF;
+			TCE1_CTRLA = TC_CLKSEL_DIV8_gc;
+		}
+	}
+	
+	pulse_us_timer_update();
+}
+
+
+/************************************************************************/
+/* REG_POKE_CAPTURE                                                     */
+/************************************************************************/
+void app_read_REG_POKE_CAPTURE(void) {}
+bool app_write_REG_POKE_CAPTURE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(B_DI0 | B_DI1 | B_DI2))
+		return false;
+	
+	app_regs.REG_POKE_CAPTURE = reg;
+	poke_capture_update();
+	return true;
+}
+
+
+/************************************************************************/
+/* Digital input debounce                                               */
+/************************************************************************/
+uint8_t di_holding = 0;
+
+/* End of each line's hold-off, in 32 us of the timestamp, and its microseconds for CCB */
+static uint32_t di_holdoff_end[4];
+static uint16_t di_holdoff_usecond[4];
+
+/* Must be called with interrupts disabled. Loads CCB with the earliest of */
+/* the schedule head and the hold-off ends, and returns true instead if    */
+/* that one is already due, leaving a pending match alone.                 */
+static bool timestamp_compare_arm(void)
+{
+	uint32_t second;
+	uint16_t usecond;
+	int32_t earliest = 0x7FFFFFFF;
+	uint16_t compare = 0;
+	
+	if (!schedule_queued && !di_holding)
+	{
+		TCC1_INTCTRLB &= ~TC_CCBINTLVL_gm;
+		return false;
+	}
+	
+	timestamp_now(&second, &usecond);
+	
+	if (schedule_queued)
+	{
+		scheduled_output_t * head = &schedule[schedule_head];
+		
+		if (!schedule_is_later(head, second, usecond))
+			return true;
+		
+		/* Heads more than a second away are later than any hold-off */
+		if (head->second - second < 2)
+		{
+			earliest = (int32_t)(head->second - second) * 31250 + head->usecond - usecond;
+		}
+		compare = head->usecond;
+	}
+	
+	uint32_t now = second * 31250 + usecond;
+	
+	for (uint8_t di = 0; di < 4; di++)
+	{
+		if (!(di_holding & (1 << di)))
+			continue;
+		
+		/* A hold-off is at most 1 s, so a longer one left comes from a timestamp set back */
+		int32_t left = di_holdoff_end[di] - now;
+		
+		if (left <= 0 || left > 31250)
+			return true;
+		
+		if (left < earliest)
+		{
+			earliest = left;
+			compare = di_holdoff_usecond[di];
+		}
+	}
+	
+	TCC1_CCB = compare;
+	TCC1_INTFLAGS = TC1_CCBIF_bm;
+	TCC1_INTCTRLB = (TCC1_INTCTRLB & ~TC_CCBINTLVL_gm) | TC_CCBINTLVL_LO_gc;
+	
+	/* The count may have passed the compare while it was loaded */
+	timestamp_now(&second, &usecond);
+	
+	return (int32_t)(second * 31250 + usecond - now) >= earliest;
+}
+
+void di_debounce(uint8_t di, bool level)
+{
+	uint8_t mask = 1 << di;
+	uint32_t second;
+	uint16_t usecond;
+	
+	uint8_t sreg = SREG;
+	cli();
+	timestamp_now(&second, &usecond);
+	SREG = sreg;
+	
+	uint32_t now = second * 31250 + usecond;
+	
+	if (di_holding & mask)
+	{
+		/* A hold-off is at most 1 s, so a longer one left comes from a timestamp set back */
+		int32_t left = di_holdoff_end[di] - now;
+		
+		if (left > 0 && left <= 31250)
+			return;
+		
+		di_holding &= ~mask;
+	}
+	
+	/* bool is a uint8_t here, so the level may be the pin's mask */
+	if (!level == !(app_regs.REG_PORT_DIS & mask))
+		return;
+	
+	app_regs.REG_PORT_DIS ^= mask;
+	
+	/* A poke routed in hardware follows its raw edges instead */
+	if (!(mimic_hw_routed & mask)) switch (di)
+	{
+		case 0: mimic_ir_or_valve(app_regs.REG_MIMIC_PORT0_IR, level ? _SET_IO_ : _CLR_IO_); break;
+		case 1: mimic_ir_or_valve(app_regs.REG_MIMIC_PORT1_IR, level ? _SET_IO_ : _CLR_IO_); break;
+		case 2: mimic_ir_or_valve(app_regs.REG_MIMIC_PORT2_IR, level ? _SET_IO_ : _CLR_IO_); break;
+	}
+	
+	if (level && waveform_armed)
+		waveform_trigger(mask);
+	
+	if (app_regs.REG_EVNT_ENABLE & B_EVT_PORT_DIS)
+	{
+		if (di < 3)
+			poke_send_event(di);
+		else
+			tx_send_event(ADD_REG_PORT_DIS, true);
+	}
+	
+	uint32_t holdoff = level ? app_regs.REG_DI_DEBOUNCE_RISE[di] : app_regs.REG_DI_DEBOUNCE_FALL[di];
+	
+	if (holdoff)
+	{
+		uint16_t units = (holdoff + 31) / 32;
+		uint16_t end = usecond + units;
+		
+		sreg = SREG;
+		cli();
+		di_holdoff_end[di] = now + units;
+		di_holdoff_usecond[di] = (end >= 31250) ? end - 31250 : end;
+		di_holding |= mask;
+		
+		/* A match already pending runs what's due, the re-sample is always later */
+		timestamp_compare_arm();
+		SREG = sreg;
+	}
+}
+
+/* Reports the lines that changed during a hold-off that is over */
+static void di_debounce_expire(void)
+{
+	/* Lines whose port interrupt is off, like port 2 with the encoder, aren't inputs now */
+	if (!(PORTD_INTCTRL & PORT_INT0LVL_gm)) di_holding &= ~B_DI0;
+	if (!(PORTE_INTCTRL & PORT_INT0LVL_gm)) di_holding &= ~B_DI1;
+	if (!(PORTF_INTCTRL & PORT_INT0LVL_gm)) di_holding &= ~B_DI2;
+	if (!(PORTH_INTCTRL & PORT_INT0LVL_gm)) di_holding &= ~B_DI3;
+	
+	if (di_holding & B_DI0) di_debounce(0, read_POKE0_IR);
+	if (di_holding & B_DI1) di_debounce(1, read_POKE1_IR);
+	if (di_holding & B_DI2) di_debounce(2, read_POKE2_IR);
+	if (di_holding & B_DI3) di_debounce(3, read_DI3);
+}
+
+void timestamp_compare_service(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+	
+	do
+	{
+		schedule_run_due();
+		
+		if (di_holding)
+			di_debounce_expire();
+	}
+	while (timestamp_compare_arm());
+	
+	SREG = sreg;
+}
+
+
+/************************************************************************/
+/* REG_DI_DEBOUNCE_RISE                                                 */
+/************************************************************************/
+void app_read_REG_DI_DEBOUNCE_RISE(void) {}
+bool app_write_REG_DI_DEBOUNCE_RISE(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+	
+	for (uint8_t i = 0; i < 4; i++)
+		if (reg[i] > 1000000)
+			return false;
+	
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_DI_DEBOUNCE_RISE[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DI_DEBOUNCE_FALL                                                 */
+/************************************************************************/
+void app_read_REG_DI_DEBOUNCE_FALL(void) {}
+bool app_write_REG_DI_DEBOUNCE_FALL(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+	
+	for (uint8_t i = 0; i < 4; i++)
+		if (reg[i] > 1000000)
+			return false;
+	
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_DI_DEBOUNCE_FALL[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* Input edge FIFO                                                      */
+/************************************************************************/
+uint8_t edge_fifo_queued = 0;
+
+static uint32_t edge_fifo_us[EDGE_FIFO_CAPACITY];
+static uint8_t edge_fifo_flags[EDGE_FIFO_CAPACITY];
+static uint8_t edge_fifo_head = 0;
+static bool edge_fifo_lost = false;
+
+/* Must be called with interrupts disabled */
+static void edge_fifo_push(uint8_t mask, bool level, uint32_t us)
+{
+	if (edge_fifo_queued == EDGE_FIFO_CAPACITY)
+	{
+		edge_fifo_lost = true;
+		return;
+	}
+	
+	uint8_t i = (edge_fifo_head + edge_fifo_queued) & (EDGE_FIFO_CAPACITY - 1);
+	
+	edge_fifo_us[i] = us;
+	edge_fifo_flags[i] = mask | (level ? B_EDGE_RISING : 0) | (edge_fifo_lost ? B_EDGE_LOST : 0);
+	edge_fifo_lost = false;
+	edge_fifo_queued++;
+}
+
+void edge_fifo_send(void)
+{
+	while (edge_fifo_queued)
+	{
+		uint32_t second;
+		uint16_t usecond;
+		
+		uint8_t sreg = SREG;
+		cli();
+		
+		timestamp_now(&second, &usecond);
+		uint32_t now_us = (second * 31250 + usecond) * 32;
+		
+		for (uint8_t i = 0; i < EDGE_FIFO_EVENT_EDGES; i++)
+		{
+			if (!edge_fifo_queued)
+			{
+				app_regs.REG_EDGE_FIFO[i] = 0;
+				continue;
+			}
+			
+			/* The age before the event's timestamp, which saturates after 16 s */
+			uint32_t age = now_us - edge_fifo_us[edge_fifo_head];
+			
+			if (age > 0xFFFFFF)
+				age = 0xFFFFFF;
+			
+			app_regs.REG_EDGE_FIFO[i] = (age << 8) | edge_fifo_flags[edge_fifo_head];
+			
+			edge_fifo_head = (edge_fifo_head + 1) & (EDGE_FIFO_CAPACITY - 1);
+			edge_fifo_queued--;
+		}
+		
+		SREG = sreg;
+		
+		tx_send_event_at(ADD_REG_EDGE_FIFO, second, usecond);
+	}
+}
+
+
+/************************************************************************/
+/* REG_EDGE_FIFO                                                        */
+/************************************************************************/
+void app_read_REG_EDGE_FIFO(void) {}
+bool app_write_REG_EDGE_FIFO(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_EDGE_FIFO_EN                                                     */
+/************************************************************************/
+void app_read_REG_EDGE_FIFO_EN(void) {}
+bool app_write_REG_EDGE_FIFO_EN(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(B_DI0 | B_DI1 | B_DI2 | B_DI3))
+		return false;
+	
+	app_regs.REG_EDGE_FIFO_EN = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* Input edge counters                                                  */
+/************************************************************************/
+static uint32_t edge_count[4];
+static uint32_t edge_first_us[4];
+static uint32_t edge_last_us[4];
+
+static uint32_t edge_window_us;
+static uint32_t edge_window_second;
+static uint16_t edge_window_usecond;
+static uint16_t edge_window_ms = 0;
+
+/* Must be called with interrupts disabled */
+static void edge_count_add(uint8_t di, uint32_t us)
+{
+	if (edge_count[di] == 0)
+		edge_first_us[di] = us;
+	
+	edge_last_us[di] = us;
+	edge_count[di]++;
+}
+
+/* Must be called with interrupts disabled */
+static void edge_count_restart(void)
+{
+	for (uint8_t i = 0; i < 4; i++)
+		edge_count[i] = 0;
+	
+	timestamp_now(&edge_window_second, &edge_window_usecond);
+	edge_window_us = (edge_window_second * 31250 + edge_window_usecond) * 32;
+	edge_window_ms = 0;
+}
+
+void edge_count_tick(void)
+{
+	if (!(app_regs.REG_EDGE_COUNT_RISING | app_regs.REG_EDGE_COUNT_FALLING))
+		return;
+	
+	if (++edge_window_ms < app_regs.REG_EDGE_COUNT_WINDOW)
+		return;
+	
+	uint8_t sreg = SREG;
+	cli();
+	
+	uint32_t second = edge_window_second;
+	uint16_t usecond = edge_window_usecond;
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		app_regs.REG_EDGE_COUNTS[i] = edge_count[i];
+		app_regs.REG_EDGE_COUNTS[4 + i] = 0;
+		app_regs.REG_EDGE_COUNTS[8 + i] = 0;
+		
+		if (edge_count[i])
+		{
+			/* A captured edge may come a little before the window it is processed in */
+			int32_t first = edge_first_us[i] - edge_window_us;
+			int32_t last = edge_last_us[i] - edge_window_us;
+			
+			app_regs.REG_EDGE_COUNTS[4 + i] = (first > 0) ? first : 0;
+			app_regs.REG_EDGE_COUNTS[8 + i] = (last > 0) ? last : 0;
+		}
+	}
+	
+	edge_count_restart();
+	
+	SREG = sreg;
+	
+	tx_send_event_at(ADD_REG_EDGE_COUNTS, second, usecond);
+}
+
+static bool edge_count_write(uint8_t *reg, uint8_t value)
+{
+	if (value & ~(B_DI0 | B_DI1 | B_DI2 | B_DI3))
+		return false;
+	
+	uint8_t sreg = SREG;
+	cli();
+	
+	/* The counts of the window so far are dropped and a new one starts */
+	*reg = value;
+	edge_count_restart();
+	
+	SREG = sreg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_EDGE_COUNT_RISING                                                */
+/************************************************************************/
+void app_read_REG_EDGE_COUNT_RISING(void) {}
+bool app_write_REG_EDGE_COUNT_RISING(void *a)
+{
+	return edge_count_write(&app_regs.REG_EDGE_COUNT_RISING, *((uint8_t*)a));
+}
+
+
+/************************************************************************/
+/* REG_EDGE_COUNT_FALLING                                               */
+/************************************************************************/
+void app_read_REG_EDGE_COUNT_FALLING(void) {}
+bool app_write_REG_EDGE_COUNT_FALLING(void *a)
+{
+	return edge_count_write(&app_regs.REG_EDGE_COUNT_FALLING, *((uint8_t*)a));
+}
+
+
+/************************************************************************/
+/* REG_EDGE_COUNT_WINDOW                                                */
+/************************************************************************/
+void app_read_REG_EDGE_COUNT_WINDOW(void) {}
+bool app_write_REG_EDGE_COUNT_WINDOW(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg == 0 || reg > 60000)
+		return false;
+	
+	app_regs.REG_EDGE_COUNT_WINDOW = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_EDGE_COUNTS                                                      */
+/************************************************************************/
+void app_read_REG_EDGE_COUNTS(void) {}
+bool app_write_REG_EDGE_COUNTS(void *a) { return false; }
+
+
+/************************************************************************/
+/* Input edges                                                          */
+/************************************************************************/
+/* Last level of each line, as its edges left it */
+static uint8_t edge_level = 0;
+
+/* Must be called with interrupts disabled */
+static void edge_add(uint8_t di, bool level, uint32_t us)
+{
+	uint8_t mask = 1 << di;
+	
+	if (app_regs.REG_EDGE_FIFO_EN & mask)
+		edge_fifo_push(mask, level, us);
+	
+	if ((level ? app_regs.REG_EDGE_COUNT_RISING : app_regs.REG_EDGE_COUNT_FALLING) & mask)
+		edge_count_add(di, us);
+}
+
+void edge_record(uint8_t di, bool level)
+{
+	uint8_t mask = 1 << di;
+	
+	uint8_t sreg = SREG;
+	cli();
+	
+	if ((app_regs.REG_EDGE_FIFO_EN | app_regs.REG_EDGE_COUNT_RISING | app_regs.REG_EDGE_COUNT_FALLING) & mask)
+	{
+		uint8_t n = (di < 3) ? poke_captures[di] : 0;
+		
+		/* Captured edges alternate and the last one left the current level */
+		for (uint8_t i = 0; i < n; i++)
+			edge_add(di, ((n - 1 - i) & 1) ? !level : !!level, poke_capture_us[di][i]);
+		
+		if (n == 0 && !level != !(edge_level & mask))
+		{
+			uint32_t second;
+			uint16_t usecond;
+			timestamp_now(&second, &usecond);
+			
+			edge_add(di, level, (second * 31250 + usecond) * 32);
+		}
+	}
+	
+	if (level)
+		edge_level |= mask;
+	else
+		edge_level &= ~mask;
+	
+	SREG = sreg;
+}
+
+
+/************************************************************************/
+/* Hardware IR mimic                                                    */
+/************************************************************************/
+uint8_t mimic_hw_routed = 0;
+
+/* DO0 to DO3 are the CCA outputs of these timers, on pin 0 of each port */
+static TC0_t * const mimic_hw_timer[4] = {&TCF0, &TCE0, &TCD0, &TCC0};
+static PORT_t * const mimic_hw_port[4] = {&PORTF, &PORTE, &PORTD, &PORTC};
+
+/* The capture channels carry every edge of the pokes' IR */
+static const uint8_t mimic_hw_clock[3] = {TC_CLKSEL_EVCH4_gc, TC_CLKSEL_EVCH5_gc, TC_CLKSEL_EVCH7_gc};
+
+/* The DO the poke is routed to, or 0xFF */
+static uint8_t mimic_hw_route[3] = {0xFF, 0xFF, 0xFF};
+
+/* The DO the poke should be routed to, or 0xFF */
+static uint8_t mimic_hw_target(uint8_t poke)
+{
+	uint8_t reg;
+	
+	switch (poke)
+	{
+		case 0: reg = app_regs.REG_MIMIC_PORT0_IR; break;
+		case 1: reg = app_regs.REG_MIMIC_PORT1_IR; break;
+		default: reg = app_regs.REG_MIMIC_PORT2_IR; break;
+	}
+	
+	if (!(app_regs.REG_MIMIC_HW & (1 << poke)))
+		return 0xFF;
+	
+	/* The encoder takes the IR of port 2 */
+	if (poke == 2 && _states_.quad_counter.port2)
+		return 0xFF;
+	
+	/* The DIOs are outputs of timers already taken */
+	if ((reg & MSK_MIMIC) < GM_MIMIC_DO0 || (reg & MSK_MIMIC) > GM_MIMIC_DO3)
+		return 0xFF;
+	
+	return (reg & MSK_MIMIC) - GM_MIMIC_DO0;
+}
+
+/* Must be called with interrupts disabled */
+static void mimic_hw_start(uint8_t poke, uint8_t output, bool level)
+{
+	TC0_t * timer = mimic_hw_timer[output];
+	
+	timer->CTRLA = TC_CLKSEL_OFF_gc;
+	timer->INTCTRLA = 0;
+	timer->INTCTRLB = 0;
+	timer->CTRLB = TC_WGMODE_FRQ_gc;
+	
+	/* The compare output starts at the level and toggles on every count, so on every edge */
+	timer->CTRLC = level ? TC0_CMPA_bm : 0;
+	timer->CNT = 0;
+	timer->CCA = 0;
+	timer->CTRLB = TC0_CCAEN_bm | TC_WGMODE_FRQ_gc;
+	timer->CTRLA = mimic_hw_clock[poke];
+}
+
+void mimic_hw_update(uint8_t poke, bool level)
+{
+	uint8_t sreg = SREG;
+	cli();
+	
+	uint8_t route = mimic_hw_route[poke];
+	uint8_t target = mimic_hw_target(poke);
+	
+	/* PWM, the cameras or the motors took the timer, so the software mimics the poke */
+	if (route != 0xFF)
+	{
+		TC0_t * timer = mimic_hw_timer[route];
+		
+		if (timer->CTRLA != mimic_hw_clock[poke] || timer->CTRLB != (TC0_CCAEN_bm | TC_WGMODE_FRQ_gc))
+			route = 0xFF;
+	}
+	
+	/* The output goes back to its port level */
+	if (route != 0xFF && route != target)
+	{
+		timer_type0_stop(mimic_hw_timer[route]);
+		route = 0xFF;
+	}
+	
+	/* A busy timer is taken when free at a later edge */
+	if (route == 0xFF && target != 0xFF && mimic_hw_timer[target]->CTRLA == TC_CLKSEL_OFF_gc)
+	{
+		mimic_hw_start(poke, target, level);
+		route = target;
+	}
+	
+	/* An edge lost by the event system left the output inverted */
+	else if (route != 0xFF && !(mimic_hw_port[route]->IN & (1 << 0)) != !level)
+	{
+		mimic_hw_start(poke, route, level);
+	}
+	
+	mimic_hw_route[poke] = route;
+	
+	if (route != 0xFF)
+		mimic_hw_routed |= (1 << poke);
+	else
+		mimic_hw_routed &= ~(1 << poke);
+	
+	SREG = sreg;
+}
+
+void mimic_hw_update_all(void)
+{
+	mimic_hw_update(0, read_POKE0_IR);
+	mimic_hw_update(1, read_POKE1_IR);
+	mimic_hw_update(2, read_POKE2_IR);
+}
+
+
+/************************************************************************/
+/* REG_MIMIC_HW                                                         */
+/************************************************************************/
+void app_read_REG_MIMIC_HW(void) {}
+bool app_write_REG_MIMIC_HW(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(B_DI0 | B_DI1 | B_DI2))
+		return false;
+	
+	app_regs.REG_MIMIC_HW = reg;
+	mimic_hw_update_all();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_MIMIC_HW_ROUTED                                                  */
+/************************************************************************/
+void app_read_REG_MIMIC_HW_ROUTED(void)
+{
+	app_regs.REG_MIMIC_HW_ROUTED = mimic_hw_routed;
+}
+bool app_write_REG_MIMIC_HW_ROUTED(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_EVNT_ENABLE_EXT                                                  */
+/************************************************************************/
+void app_read_REG_EVNT_ENABLE_EXT(void) {}
+bool app_write_REG_EVNT_ENABLE_EXT(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~B_EVT_WAVEFORM_DONE)
+		return false;
+	
+	app_regs.REG_EVNT_ENABLE_EXT = reg;
+	return true;
+}
@@ -1,6 +1,7 @@
 #ifndef _APP_FUNCTIONS_H_
 #define _APP_FUNCTIONS_H_
 #include <avr/io.h>
+#include <avr/interrupt.h>
 
 
 /************************************************************************/
@@ -72,20 +73,20 @@ void app_read_REG_EN_SERVOS(void);
 void app_read_REG_DIS_SERVOS(void);
 void app_read_REG_EN_ENCODERS(void);
 void app_read_REG_CONF_ENCODERS(void);
-void app_read_REG_RESERVED2(void);
-void app_read_REG_RESERVED3(void);
-void app_read_REG_RESERVED4(void);
-void app_read_REG_RESERVED5(void);
-void app_read_REG_RESERVED6(void);
-void app_read_REG_RESERVED7(void);
-void app_read_REG_RESERVED8(void);
-void app_read_REG_RESERVED9(void);
+void app_read_REG_PROFILER_CTRL(void);
+void app_read_REG_PROFILER_POKES(void);
+void app_read_REG_PROFILER_TIMERS_OVF(void);
+void app_read_REG_PROFILER_TIMERS_CCA(void);
+void app_read_REG_PROFILER_ADC(void);
+void app_read_REG_PROFILER_SERIAL_TSTAMP(void);
+void app_read_REG_PROFILER_T_1MS(void);
+void app_read_REG_PROFILER_T_500US(void);
 void app_read_REG_CAM_OUT0_FRAME_ACQUIRED(void);
 void app_read_REG_CAM_OUT0_FREQ(void);
 void app_read_REG_CAM_OUT1_FRAME_ACQUIRED(void);
 void app_read_REG_CAM_OUT1_FREQ(void);
-void app_read_REG_RESERVED10(void);
-void app_read_REG_RESERVED11(void);
+void app_read_REG_TX_BUFFER_STATS(void);
+void app_read_REG_CPU_LOAD(void);
 void app_read_REG_RESERVED12(void);
 void app_read_REG_RESERVED13(void);
 void app_read_REG_MOTOR_OUT2_PERIOD(void);
@@ -111,6 +112,48 @@ void app_read_REG_MIMIC_PORT2_VALVE(void);
 void app_read_REG_RESERVED23(void);
 void app_read_REG_RESERVED24(void);
 void app_read_REG_POKE_INPUT_FILTER_MS(void);
+void app_read_REG_PULSE_HIGH_RES(void);
+void app_read_REG_TRAIN_WIDTH(void);
+void app_read_REG_TRAIN_PERIOD(void);
+void app_read_REG_TRAIN_COUNT(void);
+void app_read_REG_TRAIN_START(void);
+void app_read_REG_TRAIN_STOP(void);
+void app_read_REG_TRAIN_DONE(void);
+void app_read_REG_SCHEDULE_ADD(void);
+void app_read_REG_SCHEDULE_DEPTH(void);
+void app_read_REG_SCHEDULE_FLUSH(void);
+void app_read_REG_SCHEDULE_DONE(void);
+void app_read_REG_TRANSACTION(void);
+void app_read_REG_START_AT(void);
+void app_read_REG_PWM_START_SYNC(void);
+void app_read_REG_PWM_PHASE(void);
+void app_read_REG_CHIRP_FREQ_START(void);
+void app_read_REG_CHIRP_FREQ_END(void);
+void app_read_REG_CHIRP_DURATION(void);
+void app_read_REG_CHIRP_SHAPE(void);
+void app_read_REG_CHIRP_START(void);
+void app_read_REG_WAVEFORM_DATA(void);
+void app_read_REG_WAVEFORM_LENGTH(void);
+void app_read_REG_WAVEFORM_RATE(void);
+void app_read_REG_WAVEFORM_REPEAT(void);
+void app_read_REG_WAVEFORM_TRIGGER(void);
+void app_read_REG_WAVEFORM_START(void);
+void app_read_REG_WAVEFORM_STOP(void);
+void app_read_REG_WAVEFORM_DONE(void);
+void app_read_REG_PWM_FREQ_FINE(void);
+void app_read_REG_PWM_DCYCLE_FINE(void);
+void app_read_REG_POKE_CAPTURE(void);
+void app_read_REG_DI_DEBOUNCE_RISE(void);
+void app_read_REG_DI_DEBOUNCE_FALL(void);
+void app_read_REG_EDGE_FIFO(void);
+void app_read_REG_EDGE_FIFO_EN(void);
+void app_read_REG_EDGE_COUNT_RISING(void);
+void app_read_REG_EDGE_COUNT_FALLING(void);
+void app_read_REG_EDGE_COUNT_WINDOW(void);
+void app_read_REG_EDGE_COUNTS(void);
+void app_read_REG_MIMIC_HW(void);
+void app_read_REG_MIMIC_HW_ROUTED(void);
+void app_read_REG_EVNT_ENABLE_EXT(void);
 
 
 bool app_write_REG_PORT_DIS(void *a);
@@ -165,20 +208,20 @@ bool app_write_REG_EN_SERVOS(void *a);
 bool app_write_REG_DIS_SERVOS(void *a);
 bool app_write_REG_EN_ENCODERS(void *a);
 bool app_write_REG_CONF_ENCODERS(void *a);
-bool app_write_REG_RESERVED2(void *a);
-bool app_write_REG_RESERVED3(void *a);
-bool app_write_REG_RESERVED4(void *a);
-bool app_write_REG_RESERVED5(void *a);
-bool app_write_REG_RESERVED6(void *a);
-bool app_write_REG_RESERVED7(void *a);
-bool app_write_REG_RESERVED8(void *a);
-bool app_write_REG_RESERVED9(void *a);
+bool app_write_REG_PROFILER_CTRL(void *a);
+bool app_write_REG_PROFILER_POKES(void *a);
+bool app_write_REG_PROFILER_TIMERS_OVF(void *a);
+bool app_write_REG_PROFILER_TIMERS_CCA(void *a);
+bool app_write_REG_PROFILER_ADC(void *a);
+bool app_write_REG_PROFILER_SERIAL_TSTAMP(void *a);
+bool app_write_REG_PROFILER_T_1MS(void *a);
+bool app_write_REG_PROFILER_T_500US(void *a);
 bool app_write_REG_CAM_OUT0_FRAME_ACQUIRED(void *a);
 bool app_write_REG_CAM_OUT0_FREQ(void *a);
 bool app_write_REG_CAM_OUT1_FRAME_ACQUIRED(void *a);
 bool app_write_REG_CAM_OUT1_FREQ(void *a);
-bool app_write_REG_RESERVED10(void *a);
-bool app_write_REG_RESERVED11(void *a);
+bool app_write_REG_TX_BUFFER_STATS(void *a);
+bool app_write_REG_CPU_LOAD(void *a);
 bool app_write_REG_RESERVED12(void *a);
 bool app_write_REG_RESERVED13(void *a);
 bool app_write_REG_MOTOR_OUT2_PERIOD(void *a);
@@ -204,6 +247,369 @@ bool app_write_REG_MIMIC_PORT2_VALVE(void *a);
 bool app_write_REG_RESERVED23(void *a);
 bool app_write_REG_RESERVED24(void *a);
 bool app_write_REG_POKE_INPUT_FILTER_MS(void *a);
+bool app_write_REG_PULSE_HIGH_RES(void *a);
+bool app_write_REG_TRAIN_WIDTH(void *a);
+bool app_write_REG_TRAIN_PERIOD(void *a);
+bool app_write_REG_TRAIN_COUNT(void *a);
+bool app_write_REG_TRAIN_START(void *a);
+bool app_write_REG_TRAIN_STOP(void *a);
+bool app_write_REG_TRAIN_DONE(void *a);
+bool app_write_REG_SCHEDULE_ADD(void *a);
+bool app_write_REG_SCHEDULE_DEPTH(void *a);
+bool app_write_REG_SCHEDULE_FLUSH(void *a);
+bool app_write_REG_SCHEDULE_DONE(void *a);
+bool app_write_REG_TRANSACTION(void *a);
+bool app_write_REG_START_AT(void *a);
+bool app_write_REG_PWM_START_SYNC(void *a);
+bool app_write_REG_PWM_PHASE(void *a);
+bool app_write_REG_CHIRP_FREQ_START(void *a);
+bool app_write_REG_CHIRP_FREQ_END(void *a);
+bool app_write_REG_CHIRP_DURATION(void *a);
+bool app_write_REG_CHIRP_SHAPE(void *a);
+bool app_write_REG_CHIRP_START(void *a);
+bool app_write_REG_WAVEFORM_DATA(void *a);
+bool app_write_REG_WAVEFORM_LENGTH(void *a);
+bool app_write_REG_WAVEFORM_RATE(void *a);
+bool app_write_REG_WAVEFORM_REPEAT(void *a);
+bool app_write_REG_WAVEFORM_TRIGGER(void *a);
+bool app_write_REG_WAVEFORM_START(void *a);
+bool app_write_REG_WAVEFORM_STOP(void *a);
+bool app_write_REG_WAVEFORM_DONE(void *a);
+bool app_write_REG_PWM_FREQ_FINE(void *a);
+bool app_write_REG_PWM_DCYCLE_FINE(void *a);
+bool app_write_REG_POKE_CAPTURE(void *a);
+bool app_write_REG_DI_DEBOUNCE_RISE(void *a);
+bool app_write_REG_DI_DEBOUNCE_FALL(void *a);
+bool app_write_REG_EDGE_FIFO(void *a);
+bool app_write_REG_EDGE_FIFO_EN(void *a);
+bool app_write_REG_EDGE_COUNT_RISING(void *a);
+bool app_write_REG_EDGE_COUNT_FALLING(void *a);
+bool app_write_REG_EDGE_COUNT_WINDOW(void *a);
+bool app_write_REG_EDGE_COUNTS(void *a);
+bool app_write_REG_MIMIC_HW(void *a);
+bool app_write_REG_MIMIC_HW_ROUTED(void *a);
+bool app_write_REG_EVNT_ENABLE_EXT(void *a);
+
+
+/************************************************************************/
+/* ISR profiler                                                         */
+/*                                                                      */
+/* profiler_start() and profiler_stop() wrap the body of an ISR or      */
+/* callback and record the cycles spent between them, read from TCE1.   */
+/* When disabled they cost a flag test each.                            */
+/*                                                                      */
+/* profiler_nested accumulates the cycles of every probe that ended, so */
+/* a probe can subtract the time it was preempted for when adding to    */
+/* the CPU load.                                                        */
+/************************************************************************/
+#define PROFILER_POKE0_IR           0
+#define PROFILER_POKE1_IR           1
+#define PROFILER_POKE2_IR           2
+#define PROFILER_DI3                3
+#define PROFILER_TCF0_OVF           4
+#define PROFILER_TCE0_OVF           5
+#define PROFILER_TCD0_OVF           6
+#define PROFILER_TCC0_OVF           7
+#define PROFILER_TCF0_CCA           8
+#define PROFILER_TCE0_CCA           9
+#define PROFILER_ADCA_CH0           10
+#define PROFILER_USARTF1_DRE        11
+#define PROFILER_T_1MS              12
+#define PROFILER_T_500US            13
+#define PROFILER_PROBES             14
+
+extern bool profiler_enabled;
+extern uint16_t profiler_nested;
+void profiler_record(uint8_t probe, uint16_t t0, uint16_t n0);
+void profiler_timer_update(void);
+
+/* TCE1's 16-bit TEMP register is shared, so a nested ISR mustn't read it in between */
+static inline void profiler_begin(uint16_t *t0, uint16_t *n0)
+{
+	uint8_t sreg = SREG;
+	cli();
+	*t0 = TCE1_CNT;
+	*n0 = profiler_nested;
+	SREG = sreg;
+}
+
+#define profiler_start() bool profiler_on = profiler_enabled; uint16_t profiler_t0 = 0, profiler_n0 = 0; if (profiler_on) profiler_begin(&profiler_t0, &profiler_n0)
+#define profiler_stop(probe) do { if (profiler_on) profiler_record(probe, profiler_t0, profiler_n0); } while(0)
+
+
+/************************************************************************/
+/* Harp TX buffer monitor                                               */
+/*                                                                      */
+/* tx_send_event() replaces core_func_send_event() in the application. */
+/* Events that don't fit in the TX buffer are dropped and counted       */
+/* instead of overwriting data still waiting to be sent.                */
+/************************************************************************/
+/* Size txbuff_hwbp_uart is allocated with in libATxmega128A1U-1.15.a,  */
+/* which differs from HWBP_UART_TXBUFSIZ in hwbp_core_com.h             */
+#define TX_BUFFER_SIZE              5120
+/* Header, timestamp and checksum of a Harp message */
+#define HARP_MESSAGE_OVERHEAD       12
+
+void tx_send_event(uint8_t add, bool use_core_timestamp);
+/* Sends the event stamped with the given time, the user timestamp is kept */
+void tx_send_event_at(uint8_t add, uint32_t second, uint16_t usecond);
+
+
+/************************************************************************/
+/* CPU load                                                             */
+/*                                                                      */
+/* The load is measured while the profiler or the CpuLoad event is      */
+/* enabled, and for a while after each read of REG_CPU_LOAD. Until a    */
+/* whole second was measured the register reads CPU_LOAD_UNKNOWN.       */
+/************************************************************************/
+#define CPU_LOAD_POLL_SECONDS       10
+#define CPU_LOAD_UNKNOWN            0xFFFF
+
+/* Seconds the load is still measured for after the last read */
+extern uint8_t cpu_load_polled;
+/* The current second started with the measurement and isn't reported */
+extern bool cpu_load_partial;
+
+/* Publishes the last second's load on REG_CPU_LOAD, called every second */
+void cpu_load_update(void);
+
+
+/************************************************************************/
+/* Pulse scheduler                                                      */
+/*                                                                      */
+/* Active pulses wait in a queue sorted by deadline, counted in 500 us  */
+/* ticks. core_callback_t_500us() only compares the tick with the       */
+/* earliest deadline, so an idle tick costs the same however many       */
+/* channels there are and only ending pulses add work.                  */
+/************************************************************************/
+#define PULSE_POKE0_LED             0
+#define PULSE_POKE1_LED             1
+#define PULSE_POKE2_LED             2
+#define PULSE_POKE0_VALVE           3
+#define PULSE_POKE1_VALVE           4
+#define PULSE_POKE2_VALVE           5
+#define PULSE_LED0                  6
+#define PULSE_LED1                  7
+#define PULSE_RGB0                  8
+#define PULSE_RGB1                  9
+#define PULSE_DO0                   10
+#define PULSE_DO1                   11
+#define PULSE_DO2                   12
+#define PULSE_DO3                   13
+#define PULSE_CHANNELS              14
+#define PULSE_NONE                  0xFF
+
+extern uint16_t pulse_tick;
+extern uint16_t pulse_next_deadline;
+extern uint8_t pulse_queued;
+
+/* Ends the channel's pulse after the given number of ticks, replacing any */
+/* pulse it already had. Zero ticks only cancels the current pulse.        */
+void pulse_schedule(uint8_t channel, uint16_t ticks);
+/* Removes and returns the next channel due on this tick, or PULSE_NONE */
+uint8_t pulse_pop_expired(void);
+/* Clears the channel's output, called when its pulse ends */
+void pulse_expire(uint8_t channel);
+
+
+/************************************************************************/
+/* High resolution pulses                                               */
+/*                                                                      */
+/* Channels selected in REG_PULSE_HIGH_RES count their pulse in         */
+/* microseconds instead. TCF1 runs free at 4 MHz and its overflows      */
+/* extend the count to 32 bits, so a second queue holds deadlines in    */
+/* timer counts and CCA is always loaded with the earliest one. Its     */
+/* high level compare interrupt ends the pulse within a few             */
+/* microseconds of the deadline, whatever the core tick is doing.       */
+/************************************************************************/
+/* The RGBs are refreshed by a bit-banged stream, so they stay on ticks */
+#define PULSE_HIGH_RES_MASK         (B_PORT0_DO | B_PORT1_DO | B_PORT2_DO | B_PORT0_12V | B_PORT1_12V | B_PORT2_12V | B_LED0 | B_LED1 | B_DO0 | B_DO1 | B_DO2 | B_DO3)
+#define PULSE_US_COUNTS             4
+
+extern uint16_t pulse_us_epoch;
+
+/* Ends the channel's pulse after the given number of microseconds, replacing */
+/* any pulse it already had on either queue                                   */
+void pulse_schedule_us(uint8_t channel, uint16_t us);
+/* Ends every pulse that is due and loads CCA with the next deadline */
+void pulse_us_expire(void);
+/* Starts or stops TCF1 following REG_PULSE_HIGH_RES */
+void pulse_us_timer_update(void);
+
+
+/************************************************************************/
+/* Pulse trains                                                         */
+/*                                                                      */
+/* A train alternates its output between the two parts of each period,  */
+/* each edge scheduled on the pulse queues from the previous edge's     */
+/* deadline so the period doesn't drift. Trains in high resolution mode */
+/* start at once, the others on the next tick so every pulse is a whole */
+/* number of ticks. In high resolution mode both parts last at least    */
+/* TRAIN_US_MIN us, and an edge served late starts its part from then.  */
+/************************************************************************/
+/* Shortest part of a high resolution train, well above the cost of an expiry */
+#define TRAIN_US_MIN                50
+
+#define TRAIN_MASK                  (B_PORT0_12V | B_PORT1_12V | B_PORT2_12V | B_DO0 | B_DO1 | B_DO2 | B_DO3)
+#define TRAIN_CHANNELS              7
+
+extern uint16_t pulse_train_done;
+
+/* Called first when a pulse ends, returns true if the train took over the output */
+bool pulse_train_step(uint8_t channel);
+/* Publishes the trains that completed on REG_TRAIN_DONE */
+void pulse_train_report(void);
+
+
+/************************************************************************/
+/* Output schedule                                                      */
+/*                                                                      */
+/* Operations on REG_OUTPUTS_SET, CLEAR and TOGGLE run at their Harp    */
+/* timestamp, in timestamp order. TCC1, the core's timestamp timer,     */
+/* counts the microseconds in 32 us units and its CCB compare is free,  */
+/* so the head's time is loaded there and checked on every match. The   */
+/* debounce hold-offs share the compare, which waits for the earliest.  */
+/************************************************************************/
+#define SCHEDULE_CAPACITY           64
+#define SCHEDULE_UPLOAD_ENTRIES     8
+#define SCHEDULE_ENTRY_WORDS        6
+#define SCHEDULE_MASK               (B_PORT0_DO | B_PORT1_DO | B_PORT2_DO | B_PORT0_12V | B_PORT1_12V | B_PORT2_12V | B_LED0 | B_LED1 | B_DO0 | B_DO1 | B_DO2 | B_DO3)
+
+extern uint8_t schedule_queued;
+
+/* Runs the operations and ends the hold-offs that are due, and loads */
+/* CCB with the next one                                             */
+void timestamp_compare_service(void);
+/* Starts the selected cameras at once, their outputs must already be low */
+void start_selected_cameras(uint8_t reg);
+
+
+/************************************************************************/
+/* PWM chirps                                                           */
+/*                                                                      */
+/* A chirp sweeps a PWM output from its start to its end frequency. The */
+/* frequency steps every millisecond and the timer configuration goes   */
+/* through the same double buffer as REG_FREQ_DOx, so each new period   */
+/* starts from the overflow interrupt without glitches.                 */
+/************************************************************************/
+extern uint8_t pwm_chirp_active;
+
+/* Steps the frequency of every chirp, called every millisecond */
+void pwm_chirp_update(void);
+
+
+/************************************************************************/
+/* LED current waveforms                                                */
+/*                                                                      */
+/* A table of DAC samples is copied to the LED currents by the DMA.     */
+/* TCD1, the timer of the port 2 encoder, overflows at the sample rate  */
+/* and event channel 2 carries the overflow to DMA channels 0 and 1,    */
+/* which write the next sample to DACB CH1DATA (LED 0) and CH0DATA      */
+/* (LED 1). The CPU only takes part when a playback starts and ends.    */
+/************************************************************************/
+#define WAVEFORM_CAPACITY           256
+#define WAVEFORM_UPLOAD_SAMPLES     32
+#define WAVEFORM_MASK               (B_WAVEFORM_LED0 | B_WAVEFORM_LED1)
+
+extern uint8_t waveform_armed;
+
+/* Starts the armed waveforms if one of the inputs is a trigger */
+void waveform_trigger(uint8_t inputs);
+/* Called by the DMA channel when its last repetition was copied */
+void waveform_finished(uint8_t mask);
+/* Called on the sample after the last one, while any waveform ends */
+void waveform_end(void);
+/* Stops or disarms the waveforms and restores their LED currents */
+void waveform_stop(uint8_t mask);
+
+
+/************************************************************************/
+/* Poke edge capture                                                    */
+/*                                                                      */
+/* The infrared pins of the pokes drive event channels 4, 5 and 7, so   */
+/* each edge latches TCE1 CCA (poke 0), TCE1 CCB (poke 1) or TCF1 CCB   */
+/* (poke 2) in hardware. The ISR takes the time elapsed since the edge  */
+/* off the current timestamp, so the REG_PORT_DIS event doesn't carry   */
+/* the interrupt latency. The counts reach 16 ms back, or 2 ms for the  */
+/* pokes 0 and 1 while the profiler keeps TCE1 at the CPU clock.        */
+/************************************************************************/
+/* Reads the poke's capture, called by its ISR on every entry */
+void poke_capture(uint8_t poke);
+/* Sends REG_PORT_DIS with the time of the captured edge, if there's one */
+void poke_send_event(uint8_t poke);
+/* Applies REG_POKE_CAPTURE to the timers and the event channels */
+void poke_capture_update(void);
+
+
+/************************************************************************/
+/* Digital input debounce                                               */
+/*                                                                      */
+/* Each of DI0 to DI3 holds off on its own after an edge it reports,    */
+/* for REG_DI_DEBOUNCE_RISE or REG_DI_DEBOUNCE_FALL, timed on the       */
+/* timestamp to 32 us. The port interrupt stays on, so the other lines  */
+/* of the port are still served. A line that changed while holding off  */
+/* is reported when its time is over, from TCC1's CCB compare.          */
+/************************************************************************/
+extern uint8_t di_holding;
+
+/* Reports a new level of the line unless it's holding off */
+void di_debounce(uint8_t di, bool level);
+
+
+/************************************************************************/
+/* Input edge FIFO                                                      */
+/*                                                                      */
+/* Every edge of the lines in REG_EDGE_FIFO_EN is queued with its time  */
+/* in us, whatever the debounce makes of it. The pokes take the time of */
+/* each hardware capture, up to the two a capture channel buffers, and  */
+/* DI3 or a poke without a capture the time of its interrupt. The 1 ms  */
+/* callback sends the queue in REG_EDGE_FIFO events of 8 edges.         */
+/************************************************************************/
+#define EDGE_FIFO_CAPACITY          32
+#define EDGE_FIFO_EVENT_EDGES       8
+
+extern uint8_t edge_fifo_queued;
+
+/* Sends the queued edges */
+void edge_fifo_send(void);
+
+
+/************************************************************************/
+/* Input edge counters                                                  */
+/*                                                                      */
+/* The edges chosen by REG_EDGE_COUNT_RISING and REG_EDGE_COUNT_FALLING */
+/* are counted over windows of REG_EDGE_COUNT_WINDOW ms. Each window    */
+/* ends in a REG_EDGE_COUNTS event, timestamped with its start, holding */
+/* the count of each line, then its first and last edge times in us.  */
+/************************************************************************/
+/* Counts a ms of the window and reports it when over, called by the 1 ms callback */
+void edge_count_tick(void);
+
+
+/************************************************************************/
+/* Input edges                                                          */
+/************************************************************************/
+/* Hands the edges of the line since the last call to the FIFO and the counters, called by its ISR after poke_capture() */
+void edge_record(uint8_t di, bool level);
+
+
+
+/************************************************************************/
+/* Hardware IR mimic                                                    */
+/*                                                                      */
+/* A poke in REG_MIMIC_HW that mimics its IR on a DO clocks the DO's    */
+/* timer from the IR's capture channel, in frequency mode with a TOP of */
+/* 0, so the output toggles on every edge without the CPU. It follows   */
+/* the raw edges, before the debounce. The DIOs, a DO whose timer is    */
+/* taken and the encoder's port fall back to the software mimic, and a  */
+/* timer freed again is taken at the next edge.                         */
+/************************************************************************/
+extern uint8_t mimic_hw_routed;
+
+/* Routes, releases or resynchronizes the poke's mimic, called by its ISR and when the mimic changes */
+void mimic_hw_update(uint8_t poke, bool level);
+/* Updates the three pokes */
+void mimic_hw_update_all(void);
 
 
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
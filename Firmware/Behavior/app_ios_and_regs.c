@@ -134,6 +134,27 @@ uint8_t app_regs_type[] = {
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
@@ -142,33 +163,54 @@ uint8_t app_regs_type[] = {
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
-	TYPE_U16,
 	TYPE_U8,
-	TYPE_U16,
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
 	TYPE_U16,
 	TYPE_U16,
 	TYPE_U16,
 	TYPE_U16,
 	TYPE_U8,
 	TYPE_U8,
+	TYPE_U16,
 	TYPE_U8,
+	TYPE_U16,
 	TYPE_U8,
 	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
 	TYPE_U8,
 	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
+	TYPE_U32,
+	TYPE_U16,
 	TYPE_U8,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
+	TYPE_U16,
+	TYPE_U32,
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8
@@ -228,6 +270,29 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
+	12,
+	12,
+	6,
+	3,
+	3,
+	3,
+	3,
+	1,
+	1,
+	1,
+	1,
+	2,
+	2,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
 	1,
 	1,
 	1,
@@ -244,13 +309,26 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
+	7,
+	7,
+	7,
 	1,
 	1,
 	1,
+	48,
 	1,
 	1,
+	2,
+	64,
+	5,
 	1,
+	4,
+	4,
+	4,
+	4,
+	4,
 	1,
+	33,
 	1,
 	1,
 	1,
@@ -258,11 +336,17 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
+	4,
+	4,
 	1,
+	4,
+	4,
+	8,
 	1,
 	1,
 	1,
 	1,
+	12,
 	1,
 	1,
 	1
@@ -321,20 +405,20 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_DIS_SERVOS),
 	(uint8_t*)(&app_regs.REG_EN_ENCODERS),
 	(uint8_t*)(&app_regs.REG_CONF_ENCODERS),
-	(uint8_t*)(&app_regs.REG_RESERVED2),
-	(uint8_t*)(&app_regs.REG_RESERVED3),
-	(uint8_t*)(&app_regs.REG_RESERVED4),
-	(uint8_t*)(&app_regs.REG_RESERVED5),
-	(uint8_t*)(&app_regs.REG_RESERVED6),
-	(uint8_t*)(&app_regs.REG_RESERVED7),
-	(uint8_t*)(&app_regs.REG_RESERVED8),
-	(uint8_t*)(&app_regs.REG_RESERVED9),
+	(uint8_t*)(&app_regs.REG_PROFILER_CTRL),
+	(uint8_t*)(app_regs.REG_PROFILER_POKES),
+	(uint8_t*)(app_regs.REG_PROFILER_TIMERS_OVF),
+	(uint8_t*)(app_regs.REG_PROFILER_TIMERS_CCA),
+	(uint8_t*)(app_regs.REG_PROFILER_ADC),
+	(uint8_t*)(app_regs.REG_PROFILER_SERIAL_TSTAMP),
+	(uint8_t*)(app_regs.REG_PROFILER_T_1MS),
+	(uint8_t*)(app_regs.REG_PROFILER_T_500US),
 	(uint8_t*)(&app_regs.REG_CAM_OUT0_FRAME_ACQUIRED),
 	(uint8_t*)(&app_regs.REG_CAM_OUT0_FREQ),
 	(uint8_t*)(&app_regs.REG_CAM_OUT1_FRAME_ACQUIRED),
 	(uint8_t*)(&app_regs.REG_CAM_OUT1_FREQ),
-	(uint8_t*)(&app_regs.REG_RESERVED10),
-	(uint8_t*)(&app_regs.REG_RESERVED11),
+	(uint8_t*)(app_regs.REG_TX_BUFFER_STATS),
+	(uint8_t*)(app_regs.REG_CPU_LOAD),
 	(uint8_t*)(&app_regs.REG_RESERVED12),
 	(uint8_t*)(&app_regs.REG_RESERVED13),
 	(uint8_t*)(&app_regs.REG_MOTOR_OUT2_PERIOD),
@@ -359,5 +443,47 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_MIMIC_PORT2_VALVE),
 	(uint8_t*)(&app_regs.REG_RESERVED23),
 	(uint8_t*)(&app_regs.REG_RESERVED24),
-	(uint8_t*)(&app_regs.REG_POKE_INPUT_FILTER_MS)
+	(uint8_t*)(&app_regs.REG_POKE_INPUT_FILTER_MS),
+	(uint8_t*)(&app_regs.REG_PULSE_HIGH_RES),
+	(uint8_t*)(app_regs.REG_TRAIN_WIDTH),
+	(uint8_t*)(app_regs.REG_TRAIN_PERIOD),
+	(uint8_t*)(app_regs.REG_TRAIN_COUNT),
+	(uint8_t*)(&app_regs.REG_TRAIN_START),
+	(uint8_t*)(&app_regs.REG_TRAIN_STOP),
+	(uint8_t*)(&app_regs.REG_TRAIN_DONE),
+	(uint8_t*)(app_regs.REG_SCHEDULE_ADD),
+	(uint8_t*)(&app_regs.REG_SCHEDULE_DEPTH),
+	(uint8_t*)(&app_regs.REG_SCHEDULE_FLUSH),
+	(uint8_t*)(app_regs.REG_SCHEDULE_DONE),
+	(uint8_t*)(app_regs.REG_TRANSACTION),
+	(uint8_t*)(app_regs.REG_START_AT),
+	(uint8_t*)(&app_regs.REG_PWM_START_SYNC),
+	(uint8_t*)(app_regs.REG_PWM_PHASE),
+	(uint8_t*)(app_regs.REG_CHIRP_FREQ_START),
+	(uint8_t*)(app_regs.REG_CHIRP_FREQ_END),
+	(uint8_t*)(app_regs.REG_CHIRP_DURATION),
+	(uint8_t*)(app_regs.REG_CHIRP_SHAPE),
+	(uint8_t*)(&app_regs.REG_CHIRP_START),
+	(uint8_t*)(app_regs.REG_WAVEFORM_DATA),
+	(uint8_t*)(&app_regs.REG_WAVEFORM_LENGTH),
+	(uint8_t*)(&app_regs.REG_WAVEFORM_RATE),
+	(uint8_t*)(&app_regs.REG_WAVEFORM_REPEAT),
+	(uint8_t*)(&app_regs.REG_WAVEFORM_TRIGGER),
+	(uint8_t*)(&app_regs.REG_WAVEFORM_START),
+	(uint8_t*)(&app_regs.REG_WAVEFORM_STOP),
+	(uint8_t*)(&app_regs.REG_WAVEFORM_DONE),
+	(uint8_t*)(app_regs.REG_PWM_FREQ_FINE),
+	(uint8_t*)(app_regs.REG_PWM_DCYCLE_FINE),
+	(uint8_t*)(&app_regs.REG_POKE_CAPTURE),
+	(uint8_t*)(app_regs.REG_DI_DEBOUNCE_RISE),
+	(uint8_t*)(app_regs.REG_DI_DEBOUNCE_FALL),
+	(uint8_t*)(app_regs.REG_EDGE_FIFO),
+	(uint8_t*)(&app_regs.REG_EDGE_FIFO_EN),
+	(uint8_t*)(&app_regs.REG_EDGE_COUNT_RISING),
+	(uint8_t*)(&app_regs.REG_EDGE_COUNT_FALLING),
+	(uint8_t*)(&app_regs.REG_EDGE_COUNT_WINDOW),
+	(uint8_t*)(app_regs.REG_EDGE_COUNTS),
+	(uint8_t*)(&app_regs.REG_MIMIC_HW),
+	(uint8_t*)(&app_regs.REG_MIMIC_HW_ROUTED),
+	(uint8_t*)(&app_regs.REG_EVNT_ENABLE_EXT)
 };
\ No newline at end of file
@@ -181,20 +181,20 @@ typedef struct
 	uint8_t REG_DIS_SERVOS;
 	uint8_t REG_EN_ENCODERS;
 	uint8_t REG_CONF_ENCODERS;
-	uint8_t REG_RESERVED2;
-	uint8_t REG_RESERVED3;
-	uint8_t REG_RESERVED4;
-	uint8_t REG_RESERVED5;
-	uint8_t REG_RESERVED6;
-	uint8_t REG_RESERVED7;
-	uint8_t REG_RESERVED8;
-	uint8_t REG_RESERVED9;
+	uint8_t REG_PROFILER_CTRL;
+	uint16_t REG_PROFILER_POKES[12];
+	uint16_t REG_PROFILER_TIMERS_OVF[12];
+	uint16_t REG_PROFILER_TIMERS_CCA[6];
+	uint16_t REG_PROFILER_ADC[3];
+	uint16_t REG_PROFILER_SERIAL_TSTAMP[3];
+	uint16_t REG_PROFILER_T_1MS[3];
+	uint16_t REG_PROFILER_T_500US[3];
 	uint8_t REG_CAM_OUT0_FRAME_ACQUIRED;
 	uint16_t REG_CAM_OUT0_FREQ;
 	uint8_t REG_CAM_OUT1_FRAME_ACQUIRED;
 	uint16_t REG_CAM_OUT1_FREQ;
-	uint8_t REG_RESERVED10;
-	uint8_t REG_RESERVED11;
+	uint16_t REG_TX_BUFFER_STATS[2];
+	uint16_t REG_CPU_LOAD[2];
 	uint8_t REG_RESERVED12;
 	uint8_t REG_RESERVED13;
 	uint16_t REG_MOTOR_OUT2_PERIOD;
@@ -220,6 +220,48 @@ typedef struct
 	uint8_t REG_RESERVED23;
 	uint8_t REG_RESERVED24;
 	uint8_t REG_POKE_INPUT_FILTER_MS;
+	uint16_t REG_PULSE_HIGH_RES;
+	uint16_t REG_TRAIN_WIDTH[7];
+	uint16_t REG_TRAIN_PERIOD[7];
+	uint16_t REG_TRAIN_COUNT[7];
+	uint16_t REG_TRAIN_START;
+	uint16_t REG_TRAIN_STOP;
+	uint16_t REG_TRAIN_DONE;
+	uint16_t REG_SCHEDULE_ADD[48];
+	uint8_t REG_SCHEDULE_DEPTH;
+	uint8_t REG_SCHEDULE_FLUSH;
+	uint16_t REG_SCHEDULE_DONE[2];
+	uint8_t REG_TRANSACTION[64];
+	uint16_t REG_START_AT[5];
+	uint8_t REG_PWM_START_SYNC;
+	uint8_t REG_PWM_PHASE[4];
+	uint16_t REG_CHIRP_FREQ_START[4];
+	uint16_t REG_CHIRP_FREQ_END[4];
+	uint16_t REG_CHIRP_DURATION[4];
+	uint8_t REG_CHIRP_SHAPE[4];
+	uint8_t REG_CHIRP_START;
+	uint16_t REG_WAVEFORM_DATA[33];
+	uint16_t REG_WAVEFORM_LENGTH;
+	uint16_t REG_WAVEFORM_RATE;
+	uint8_t REG_WAVEFORM_REPEAT;
+	uint8_t REG_WAVEFORM_TRIGGER;
+	uint8_t REG_WAVEFORM_START;
+	uint8_t REG_WAVEFORM_STOP;
+	uint8_t REG_WAVEFORM_DONE;
+	uint32_t REG_PWM_FREQ_FINE[4];
+	uint16_t REG_PWM_DCYCLE_FINE[4];
+	uint8_t REG_POKE_CAPTURE;
+	uint32_t REG_DI_DEBOUNCE_RISE[4];
+	uint32_t REG_DI_DEBOUNCE_FALL[4];
+	uint32_t REG_EDGE_FIFO[8];
+	uint8_t REG_EDGE_FIFO_EN;
+	uint8_t REG_EDGE_COUNT_RISING;
+	uint8_t REG_EDGE_COUNT_FALLING;
+	uint16_t REG_EDGE_COUNT_WINDOW;
+	uint32_t REG_EDGE_COUNTS[12];
+	uint8_t REG_MIMIC_HW;
+	uint8_t REG_MIMIC_HW_ROUTED;
+	uint8_t REG_EVNT_ENABLE_EXT;
 } AppRegs;
 
 /************************************************************************/
@@ -278,20 +320,20 @@ typedef struct
 #define ADD_REG_DIS_SERVOS                  81 // U8     Disable servo motors control
 #define ADD_REG_EN_ENCODERS                 82 // U8     Enable encoders
 #define ADD_REG_CONF_ENCODERS               83 // U8     Configure the operation mode of the quadrature encoders
-#define ADD_REG_RESERVED2                   84 // U8     Reserved for future use
-#define ADD_REG_RESERVED3                   85 // U8     Reserved for future use
-#define ADD_REG_RESERVED4                   86 // U8     Reserved for future use
-#define ADD_REG_RESERVED5                   87 // U8     Reserved for future use
-#define ADD_REG_RESERVED6                   88 // U8     Reserved for future use
-#define ADD_REG_RESERVED7                   89 // U8     Reserved for future use
-#define ADD_REG_RESERVED8                   90 // U8     Reserved for future use
-#define ADD_REG_RESERVED9                   91 // U8     Reserved for future use
+#define ADD_REG_PROFILER_CTRL               84 // U8     Enables and resets the ISR execution-time profiler
+#define ADD_REG_PROFILER_POKES              85 // U16    [POKE0_IR min mean max] [POKE1_IR ...] [POKE2_IR ...] [DI3 ...] (cycles)
+#define ADD_REG_PROFILER_TIMERS_OVF         86 // U16    [TCF0_OVF min mean max] [TCE0_OVF ...] [TCD0_OVF ...] [TCC0_OVF ...] (cycles)
+#define ADD_REG_PROFILER_TIMERS_CCA         87 // U16    [TCF0_CCA min mean max] [TCE0_CCA ...] (cycles)
+#define ADD_REG_PROFILER_ADC                88 // U16    [ADCA_CH0 min mean max] (cycles)
+#define ADD_REG_PROFILER_SERIAL_TSTAMP      89 // U16    [USARTF1_DRE min mean max] (cycles)
+#define ADD_REG_PROFILER_T_1MS              90 // U16    [1 ms callback min mean max] (cycles)
+#define ADD_REG_PROFILER_T_500US            91 // U16    [500 us callback min mean max] (cycles)
 #define ADD_REG_CAM_OUT0_FRAME_ACQUIRED     92 // U8     
 #define ADD_REG_CAM_OUT0_FREQ               93 // U16    Configures the camera's sample frequency [1;600]
 #define ADD_REG_CAM_OUT1_FRAME_ACQUIRED     94 // U8     
 #define ADD_REG_CAM_OUT1_FREQ               95 // U16    Configures the camera's sample frequency [1;600]
-#define ADD_REG_RESERVED10                  96 // U8     Reserved for future use
-#define ADD_REG_RESERVED11                  97 // U8     Reserved for future use
+#define ADD_REG_TX_BUFFER_STATS             96 // U16    [Harp TX buffer peak occupancy (bytes)] [Events dropped with the buffer full]
+#define ADD_REG_CPU_LOAD                    97 // U16    [ISR load] [Callback load] over the last second (0.01 %)
 #define ADD_REG_RESERVED12                  98 // U8     Reserved for future use
 #define ADD_REG_RESERVED13                  99 // U8     Reserved for future use
 #define ADD_REG_MOTOR_OUT2_PERIOD          100 // U16    Configures the servo motor period (us)  (sensitive to 2 us)
@@ -317,6 +359,48 @@ typedef struct
 #define ADD_REG_RESERVED23                 120 // U8     
 #define ADD_REG_RESERVED24                 121 // U8     
 #define ADD_REG_POKE_INPUT_FILTER_MS       122 // U8     Set the low pass filter time value for the pokes inputs (ms)
+#define ADD_REG_PULSE_HIGH_RES             123 // U16    Outputs whose pulse duration is in microseconds, ended by a TCF1 compare
+#define ADD_REG_TRAIN_WIDTH                124 // U16    Pulse width of the trains on Port0..2 12V and DO0..3
+#define ADD_REG_TRAIN_PERIOD               125 // U16    Interval between pulse onsets of the trains
+#define ADD_REG_TRAIN_COUNT                126 // U16    Pulses in each train, 0 runs until stopped
+#define ADD_REG_TRAIN_START                127 // U16    Starts pulse trains on the selected outputs
+#define ADD_REG_TRAIN_STOP                 128 // U16    Stops pulse trains on the selected outputs
+#define ADD_REG_TRAIN_DONE                 129 // U16    Outputs whose train just completed
+#define ADD_REG_SCHEDULE_ADD               130 // U16    Up to 8 output operations tagged with a Harp timestamp
+#define ADD_REG_SCHEDULE_DEPTH             131 // U8     Operations waiting in the output schedule
+#define ADD_REG_SCHEDULE_FLUSH             132 // U8     Empties the output schedule
+#define ADD_REG_SCHEDULE_DONE              133 // U16    Outputs and schedule depth after an operation
+#define ADD_REG_TRANSACTION                134 // U8     Register writes applied together
+#define ADD_REG_START_AT                   135 // U16    Starts PWM and camera outputs at a Harp timestamp
+#define ADD_REG_PWM_START_SYNC             136 // U8     Starts PWM outputs together on the same clock edge
+#define ADD_REG_PWM_PHASE                  137 // U8     Delay of each synchronized PWM output, in percent of its period
+#define ADD_REG_CHIRP_FREQ_START           138 // U16    Start frequency of the chirp on each PWM output
+#define ADD_REG_CHIRP_FREQ_END             139 // U16    End frequency of the chirp on each PWM output
+#define ADD_REG_CHIRP_DURATION             140 // U16    Duration of the chirp on each PWM output, in ms
+#define ADD_REG_CHIRP_SHAPE                141 // U8     Frequency curve of the chirp on each PWM output
+#define ADD_REG_CHIRP_START                142 // U8     Starts chirps on the selected PWM outputs
+#define ADD_REG_WAVEFORM_DATA              143 // U16    Start index followed by 32 samples of the waveform table
+#define ADD_REG_WAVEFORM_LENGTH            144 // U16    Number of samples played from the waveform table [1;256]
+#define ADD_REG_WAVEFORM_RATE              145 // U16    Sample rate of the waveform, in Hz [1;50000]
+#define ADD_REG_WAVEFORM_REPEAT            146 // U8     Times the waveform is played, 0 loops until stopped
+#define ADD_REG_WAVEFORM_TRIGGER           147 // U8     Poke inputs that start an armed waveform, 0 starts at once
+#define ADD_REG_WAVEFORM_START             148 // U8     Arms or starts the waveform on the selected LED currents
+#define ADD_REG_WAVEFORM_STOP              149 // U8     Stops the waveform on the selected LED currents
+#define ADD_REG_WAVEFORM_DONE              150 // U8     LED currents whose waveform finished playing
+#define ADD_REG_PWM_FREQ_FINE              151 // U32    Frequency of each PWM output, in mHz [15;50000000]
+#define ADD_REG_PWM_DCYCLE_FINE            152 // U16    Duty cycle of each PWM output, in 0.01 % [1;9999]
+#define ADD_REG_POKE_CAPTURE               153 // U8     Pokes whose events carry the captured infrared edge time (bitmask)
+#define ADD_REG_DI_DEBOUNCE_RISE           154 // U32    Hold-off of DI0 to DI3 after a rising edge (us)
+#define ADD_REG_DI_DEBOUNCE_FALL           155 // U32    Hold-off of DI0 to DI3 after a falling edge (us)
+#define ADD_REG_EDGE_FIFO                  156 // U32    Input edges, each with its age (us) << 8, B_EDGE_RISING, B_EDGE_LOST and the line
+#define ADD_REG_EDGE_FIFO_EN               157 // U8     Inputs whose edges go to EDGE_FIFO (bitmask)
+#define ADD_REG_EDGE_COUNT_RISING          158 // U8     Inputs whose rising edges are counted (bitmask)
+#define ADD_REG_EDGE_COUNT_FALLING         159 // U8     Inputs whose falling edges are counted (bitmask)
+#define ADD_REG_EDGE_COUNT_WINDOW          160 // U16    Counting window (ms)
+#define ADD_REG_EDGE_COUNTS                161 // U32    Counts, first and last edge times (us) of DI0 to DI3 in the window
+#define ADD_REG_MIMIC_HW                   162 // U8     Pokes whose IR mimic is routed in hardware when possible (bitmask)
+#define ADD_REG_MIMIC_HW_ROUTED            163 // U8     Pokes whose IR mimic is routed in hardware (bitmask)
+#define ADD_REG_EVNT_ENABLE_EXT            164 // U8     Enable the events beyond REG_EVNT_ENABLE
 
 /************************************************************************/
 /* PWM Generator registers' memory limits                               */
@@ -326,8 +410,8 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x7A
-#define APP_NBYTES_OF_REG_BANK              134
+#define APP_REGS_ADD_MAX                    0xA4
+#define APP_NBYTES_OF_REG_BANK              697
 
 /************************************************************************/
 /* Registers' bits                                                      */
@@ -362,6 +446,9 @@ typedef struct
 #define B_EVT_DATA                         (1<<2)       // Event of register ADC
 #define B_EVT_CAM0                         (1<<3)       // Event of CAM_OUT0_FRAME_ACQUIRED
 #define B_EVT_CAM1                         (1<<4)       // Event of CAM_OUT1_FRAME_ACQUIRED
+#define B_EVT_CPU_LOAD                     (1<<5)       // Event of CPU_LOAD, once per second
+#define B_EVT_TRAIN_DONE                   (1<<6)       // Event of TRAIN_DONE
+#define B_EVT_SCHEDULE_DONE                (1<<7)       // Event of SCHEDULE_DONE
 #define B_EN_CAM_OUT0                      (1<<0)       // Camera on digital output 0
 #define B_EN_CAM_OUT1                      (1<<1)       // Camera on digital output 1
 #define B_EN_SERVO_OUT2                    (1<<2)       // Servo on digital output 2
@@ -370,6 +457,8 @@ typedef struct
 #define MSK_ENCODERS_MODE                  0x01         // 
 #define GM_POSITION                        0x00         // 
 #define GM_DISPLACEMENT                    0x01         // 
+#define B_PROFILER_EN                      (1<<0)       // Enable the ISR profiler
+#define B_PROFILER_RESET                   (1<<1)       // Clear the collected statistics
 #define B_CAM_ACQ                          (1<<0)       // Camera frame was triggered
 #define B_RST_ENCODER_PORT2                (1<<2)       // Reset the encoder counter on Port 2
 #define B_EN_SRL_TSTAMP_PORT2              (1<<2)       // Enable the serial timestamp TX on Port 2
@@ -382,5 +471,15 @@ typedef struct
 #define GM_MIMIC_DO1                       0x05         // Is reflected on DO1
 #define GM_MIMIC_DO2                       0x06         // Is reflected on DO2
 #define GM_MIMIC_DO3                       0x07         // Is reflected on DO3
+#define MSK_CHIRP_SHAPE                    0x01         // 
+#define GM_CHIRP_LINEAR                    0x00         // Frequency changes by the same step every ms
+#define GM_CHIRP_EXPONENTIAL               0x01         // Frequency changes by the same ratio every ms
+#define B_WAVEFORM_LED0                    (1<<0)       // Waveform on the current of LED 0
+#define B_WAVEFORM_LED1                    (1<<1)       // Waveform on the current of LED 1
+#define MSK_EDGE_LINE                      0x0F         // B_DIx of the input with the edge
+#define B_EDGE_LOST                        (1<<6)       // Edges were lost before this one
+#define B_EDGE_RISING                      (1<<7)       // The input went high
+#define EDGE_AGE_SHIFT                     8            // Position of the edge's age in us
+#define B_EVT_WAVEFORM_DONE                (1<<0)       // Event of WAVEFORM_DONE
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
@@ -31,129 +31,93 @@ extern AppRegs app_regs;
 /************************************************************************/ 
 /* POKE0_IR                                                             */
 /************************************************************************/
-extern uint8_t int0_enable_counter;
-
 ISR(PORTD_INT0_vect, ISR_NAKED)
 {	
-   uint8_t reg_port_dis = app_regs.REG_PORT_DIS;
+   profiler_start();
+   poke_capture(0);
+   edge_record(0, read_POKE0_IR);
+   
+   if (app_regs.REG_MIMIC_HW & B_DI0)
+      mimic_hw_update(0, read_POKE0_IR);
+
    uint8_t reg_port_dios_in = app_regs.REG_PORT_DIOS_IN; 
    
-   app_regs.REG_PORT_DIS &= ~B_DI0;
-   app_regs.REG_PORT_DIS |= (read_POKE0_IR) ? B_DI0 : 0;
-		
    app_regs.REG_PORT_DIOS_IN &= ~B_DIO0;                      
    app_regs.REG_PORT_DIOS_IN |= (read_POKE0_IO) ? B_DIO0 : 0; 
 	
-	   
-   if(read_POKE0_IR)
-      mimic_ir_or_valve(app_regs.REG_MIMIC_PORT0_IR, _SET_IO_);
-   else
-      mimic_ir_or_valve(app_regs.REG_MIMIC_PORT0_IR, _CLR_IO_);
+   di_debounce(0, read_POKE0_IR);
 
 	if (app_regs.REG_EVNT_ENABLE & B_EVT_PORT_DIS)
 	{
-		if (reg_port_dis != app_regs.REG_PORT_DIS)
-		{
-			core_func_send_event(ADD_REG_PORT_DIS, true);
-		 
-			if (app_regs.REG_POKE_INPUT_FILTER_MS)
-			{
-				PORTD_INTCTRL &= 0xFC;	// Disable interrupt
-				int0_enable_counter = app_regs.REG_POKE_INPUT_FILTER_MS;
-			}
-		}
-		
 		if (reg_port_dios_in != app_regs.REG_PORT_DIOS_IN) 
 		{
-			core_func_send_event(ADD_REG_PORT_DIOS_IN, true); 
+			tx_send_event(ADD_REG_PORT_DIOS_IN, true); 
 		}
 	}
 
+	profiler_stop(PROFILER_POKE0_IR);
 	reti();
 }
 
 /************************************************************************/ 
 /* POKE1_IR                                                             */
 /************************************************************************/
-extern uint8_t int1_enable_counter;
-
 ISR(PORTE_INT0_vect, ISR_NAKED)
 {
-   uint8_t reg_port_dis = app_regs.REG_PORT_DIS;
-   uint8_t reg_port_dios_in = app_regs.REG_PORT_DIOS_IN; 
+   profiler_start();
+   poke_capture(1);
+   edge_record(1, read_POKE1_IR);
    
-   app_regs.REG_PORT_DIS &= ~B_DI1;
-   app_regs.REG_PORT_DIS |= (read_POKE1_IR) ? B_DI1 : 0;
+   if (app_regs.REG_MIMIC_HW & B_DI1)
+      mimic_hw_update(1, read_POKE1_IR);
+
+   uint8_t reg_port_dios_in = app_regs.REG_PORT_DIOS_IN; 
 	
    app_regs.REG_PORT_DIOS_IN &= ~B_DIO1;                       
    app_regs.REG_PORT_DIOS_IN |= (read_POKE1_IO) ? B_DIO1 : 0; 
    
-   if(read_POKE1_IR)
-      mimic_ir_or_valve(app_regs.REG_MIMIC_PORT1_IR, _SET_IO_);
-   else
-      mimic_ir_or_valve(app_regs.REG_MIMIC_PORT1_IR, _CLR_IO_);
+   di_debounce(1, read_POKE1_IR);
 
 	if (app_regs.REG_EVNT_ENABLE & B_EVT_PORT_DIS)
 	{
-   		if (reg_port_dis != app_regs.REG_PORT_DIS)
-   		{
-      		core_func_send_event(ADD_REG_PORT_DIS, true);
-			  
-      		if (app_regs.REG_POKE_INPUT_FILTER_MS)
-      		{
-	      		PORTE_INTCTRL &= 0xFC;	// Disable interrupt
-      			int1_enable_counter = app_regs.REG_POKE_INPUT_FILTER_MS;
-			}
-   		}
-	
 		if (reg_port_dios_in != app_regs.REG_PORT_DIOS_IN) 
 		{
-			core_func_send_event(ADD_REG_PORT_DIOS_IN, true); 
+			tx_send_event(ADD_REG_PORT_DIOS_IN, true); 
 		}
 	}
 
+	profiler_stop(PROFILER_POKE1_IR);
 	reti();
 }
 
 /************************************************************************/ 
 /* POKE2_IR                                                             */
 /************************************************************************/
-extern uint8_t int2_enable_counter;
-
 ISR(PORTF_INT0_vect, ISR_NAKED)
 {
-   uint8_t reg_port_dis = app_regs.REG_PORT_DIS;
-   uint8_t reg_port_dios_in = app_regs.REG_PORT_DIOS_IN; 
+   profiler_start();
+   poke_capture(2);
+   edge_record(2, read_POKE2_IR);
    
-   app_regs.REG_PORT_DIS &= ~B_DI2;
-   app_regs.REG_PORT_DIS |= (read_POKE2_IR) ? B_DI2 : 0;
+   if (app_regs.REG_MIMIC_HW & B_DI2)
+      mimic_hw_update(2, read_POKE2_IR);
+
+   uint8_t reg_port_dios_in = app_regs.REG_PORT_DIOS_IN; 
 	
    app_regs.REG_PORT_DIOS_IN &= ~B_DIO2;                       
    app_regs.REG_PORT_DIOS_IN |= (read_POKE2_IO) ? B_DIO2 : 0;
       
-   if(read_POKE2_IR)
-      mimic_ir_or_valve(app_regs.REG_MIMIC_PORT2_IR, _SET_IO_);
-   else
-      mimic_ir_or_valve(app_regs.REG_MIMIC_PORT2_IR, _CLR_IO_);
+   di_debounce(2, read_POKE2_IR);
    
 	if (app_regs.REG_EVNT_ENABLE & B_EVT_PORT_DIS)
 	{
-   		if (reg_port_dis != app_regs.REG_PORT_DIS)
-   		{
-      		core_func_send_event(ADD_REG_PORT_DIS, true);
-		  
-      		if (app_regs.REG_POKE_INPUT_FILTER_MS)
-      		{
-	      		PORTF_INTCTRL &= 0xFC;	// Disable interrupt
-      			int2_enable_counter = app_regs.REG_POKE_INPUT_FILTER_MS;
-			  }
-   		}
 		if (reg_port_dios_in != app_regs.REG_PORT_DIOS_IN)
 		{
-			core_func_send_event(ADD_REG_PORT_DIOS_IN, true);
+			tx_send_event(ADD_REG_PORT_DIOS_IN, true);
 		}
 	}
 
+	profiler_stop(PROFILER_POKE2_IR);
 	reti();
 }
 
@@ -162,19 +126,12 @@ ISR(PORTF_INT0_vect, ISR_NAKED)
 /************************************************************************/
 ISR(PORTH_INT0_vect, ISR_NAKED)
 {
-	uint8_t reg_port_dis = app_regs.REG_PORT_DIS;
-	
-	app_regs.REG_PORT_DIS &= ~B_DI3;
-	app_regs.REG_PORT_DIS |= (read_DI3) ? B_DI3 : 0;
-	
-	if (app_regs.REG_EVNT_ENABLE & B_EVT_PORT_DIS)
-	{
-		if (reg_port_dis != app_regs.REG_PORT_DIS)
-		{
-			core_func_send_event(ADD_REG_PORT_DIS, true);
-		}
-	}
+	profiler_start();
 
+	edge_record(3, read_DI3);
+	di_debounce(3, read_DI3);
+
+	profiler_stop(PROFILER_DI3);
 	reti();
 }
 
@@ -191,13 +148,17 @@ extern bool stop_camera_do1;
 
 ISR(TCF0_OVF_vect, ISR_NAKED)
 {
+    profiler_start();
+
     if (_states_.pwm.do0)
     {
         if (is_new_timer_conf.pwm_do0)
         {
             TCF0_PER = timer_conf.target_do0 - 1;
             TCF0_CCA = timer_conf.dcycle_do0;
-            TCF0_CTRLA = timer_conf.prescaler_do0;
+            /* A synchronized output keeps counting event channel 1 */
+            if (TCF0_CTRLA != TC_CLKSEL_EVCH1_gc)
+                TCF0_CTRLA = timer_conf.prescaler_do0;
             is_new_timer_conf.pwm_do0 = false;
         }
     }        
@@ -207,15 +168,18 @@ ISR(TCF0_OVF_vect, ISR_NAKED)
         if (app_regs.REG_EVNT_ENABLE & B_EVT_CAM0)
         {
             app_regs.REG_CAM_OUT0_FRAME_ACQUIRED = 1;
-            core_func_send_event(ADD_REG_CAM_OUT0_FRAME_ACQUIRED, true);
+            tx_send_event(ADD_REG_CAM_OUT0_FRAME_ACQUIRED, true);
         }
     }
     
+    profiler_stop(PROFILER_TCF0_OVF);
     reti();
 }
 
 ISR(TCF0_CCA_vect, ISR_NAKED)
 {
+    profiler_start();
+
     if (_states_.camera.do0)
     {
         if (stop_camera_do0)
@@ -227,22 +191,26 @@ ISR(TCF0_CCA_vect, ISR_NAKED)
             _states_.camera.do0 = false;
 				
 				app_regs.REG_STOP_CAMERAS = B_EN_CAM_OUT0;
-				core_func_send_event(ADD_REG_STOP_CAMERAS, true);
+				tx_send_event(ADD_REG_STOP_CAMERAS, true);
         }
     }        
     
+    profiler_stop(PROFILER_TCF0_CCA);
     reti();
 }
 
 ISR(TCE0_OVF_vect, ISR_NAKED)
 {
+    profiler_start();
+
     if (_states_.pwm.do1)
     {
         if (is_new_timer_conf.pwm_do1)
         {
             TCE0_PER = timer_conf.target_do1 - 1;
             TCE0_CCA = timer_conf.dcycle_do1;
-            TCE0_CTRLA = timer_conf.prescaler_do1;
+            if (TCE0_CTRLA != TC_CLKSEL_EVCH1_gc)
+                TCE0_CTRLA = timer_conf.prescaler_do1;
             is_new_timer_conf.pwm_do1 = false;
         }
     }     
@@ -252,15 +220,18 @@ ISR(TCE0_OVF_vect, ISR_NAKED)
         if (app_regs.REG_EVNT_ENABLE & B_EVT_CAM1)
         {
             app_regs.REG_CAM_OUT1_FRAME_ACQUIRED = 1;
-            core_func_send_event(ADD_REG_CAM_OUT1_FRAME_ACQUIRED, true);
+            tx_send_event(ADD_REG_CAM_OUT1_FRAME_ACQUIRED, true);
         }
     }       
     
+    profiler_stop(PROFILER_TCE0_OVF);
     reti();
 }
 
 ISR(TCE0_CCA_vect, ISR_NAKED)
 {
+    profiler_start();
+
     if (_states_.camera.do1)
     {
         if (stop_camera_do1)
@@ -272,45 +243,100 @@ ISR(TCE0_CCA_vect, ISR_NAKED)
             _states_.camera.do1 = false;
             
             app_regs.REG_STOP_CAMERAS = B_EN_CAM_OUT1;
-            core_func_send_event(ADD_REG_STOP_CAMERAS, true);
+            tx_send_event(ADD_REG_STOP_CAMERAS, true);
         }
     }        
     
+    profiler_stop(PROFILER_TCE0_CCA);
     reti();
 }
 
 ISR(TCD0_OVF_vect, ISR_NAKED)
 {
+    profiler_start();
+
     if (_states_.pwm.do2)
     {
         if (is_new_timer_conf.pwm_do2)
         {
             TCD0_PER = timer_conf.target_do2 - 1;
             TCD0_CCA = timer_conf.dcycle_do2;
-            TCD0_CTRLA = timer_conf.prescaler_do2;
+            if (TCD0_CTRLA != TC_CLKSEL_EVCH1_gc)
+                TCD0_CTRLA = timer_conf.prescaler_do2;
             is_new_timer_conf.pwm_do2 = false;
         }
     }        
     
+    profiler_stop(PROFILER_TCD0_OVF);
     reti();
 }
 
 ISR(TCC0_OVF_vect, ISR_NAKED)
 {
+    profiler_start();
+
     if (_states_.pwm.do3)
     {
         if (is_new_timer_conf.pwm_do3)
         {
             TCC0_PER = timer_conf.target_do3 - 1;
             TCC0_CCA = timer_conf.dcycle_do3;
-            TCC0_CTRLA = timer_conf.prescaler_do3;
+            if (TCC0_CTRLA != TC_CLKSEL_EVCH1_gc)
+                TCC0_CTRLA = timer_conf.prescaler_do3;
             is_new_timer_conf.pwm_do3 = false;
         }
     }
         
+    profiler_stop(PROFILER_TCC0_OVF);
     reti();
 }
 
+/************************************************************************/
+/* High resolution pulses                                               */
+/************************************************************************/
+/* High level interrupts nest into the low level ones, so they can't be naked */
+ISR(TCF1_OVF_vect)
+{
+	pulse_us_epoch++;
+}
+
+ISR(TCF1_CCA_vect)
+{
+	pulse_us_expire();
+}
+
+/************************************************************************/
+/* Output schedule and input debounce                                   */
+/************************************************************************/
+ISR(TCC1_CCB_vect, ISR_NAKED)
+{
+	timestamp_compare_service();
+	reti();
+}
+
+/************************************************************************/
+/* LED current waveforms                                                */
+/************************************************************************/
+ISR(DMA_CH0_vect, ISR_NAKED)
+{
+	DMA.CH0.CTRLB |= DMA_CH_TRNIF_bm;
+	waveform_finished(B_WAVEFORM_LED0);
+	reti();
+}
+
+ISR(DMA_CH1_vect, ISR_NAKED)
+{
+	DMA.CH1.CTRLB |= DMA_CH_TRNIF_bm;
+	waveform_finished(B_WAVEFORM_LED1);
+	reti();
+}
+
+ISR(TCD1_OVF_vect, ISR_NAKED)
+{
+	waveform_end();
+	reti();
+}
+
 /************************************************************************/
 /* ADC                                                                  */
 /************************************************************************/
@@ -320,6 +346,8 @@ extern bool first_adc_channel;
 
 ISR(ADCA_CH0_vect, ISR_NAKED)
 {
+	profiler_start();
+
 	bool send_event = false;
 	
 	if (first_adc_channel)
@@ -358,9 +386,10 @@ ISR(ADCA_CH0_vect, ISR_NAKED)
 	{
 		if (app_regs.REG_EVNT_ENABLE & B_EVT_DATA)
 		{
-			core_func_send_event(ADD_REG_DATA, false);
+			tx_send_event(ADD_REG_DATA, false);
 		}
 	}	
 		
+	profiler_stop(PROFILER_ADCA_CH0);
 	reti();
 }
\ No newline at end of file
@@ -1,15 +1,6 @@
 #ifndef _STRUCTS_H_
 #define _STRUCTS_H
 
-typedef struct
-{
-    uint16_t poke0_led, poke1_led, poke2_led;
-    uint16_t poke0_valve, poke1_valve, poke2_valve;
-    uint16_t led0, led1;
-    uint16_t rgb0, rgb1;
-    uint16_t do0, do1, do2, do3;
-} countdown_t;
-
 typedef struct
 {
     uint8_t prescaler_do0, prescaler_do1, prescaler_do2, prescaler_do3;
@@ -22,6 +13,23 @@ typedef struct
     bool pwm_do0, pwm_do1, pwm_do2, pwm_do3;
 } is_new_timer_conf_t;
 
+/* Execution time of an ISR, in CPU cycles */
+typedef struct
+{
+    uint16_t min, max;
+    uint16_t count;
+    uint32_t sum;
+} profiler_probe_t;
+
+/* Output operation waiting for its Harp timestamp, usecond in 32 us units */
+typedef struct
+{
+    uint32_t second;
+    uint16_t usecond;
+    uint16_t set, clear, toggle;
+    uint8_t pwm_start, cameras_start;
+} scheduled_output_t;
+
 
 /* State of output ports */
 typedef struct
@@ -0,0 +1,475 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "hwbp_core.h"
+#include "hwbp_core_types.h"
+#include "app_ios_and_regs.h"
+#include "app_funcs.h"
+#include "structs.h"
+
+#include "hwbp_core_host.h"
+
+/************************************************************************/
+/* Application symbols driven by the bench                              */
+/************************************************************************/
+extern AppRegs app_regs;
+
+extern bool first_adc_channel;
+extern bool stop_camera_do0;
+extern bool stop_camera_do1;
+extern uint8_t timestamp_tx_index;
+extern is_new_timer_conf_t is_new_timer_conf;
+
+void PORTD_INT0_vect(void);
+void PORTE_INT0_vect(void);
+void PORTF_INT0_vect(void);
+void PORTH_INT0_vect(void);
+void TCF0_OVF_vect(void);
+void TCF0_CCA_vect(void);
+void TCE0_OVF_vect(void);
+void TCE0_CCA_vect(void);
+void TCD0_OVF_vect(void);
+void TCC0_OVF_vect(void);
+void ADCA_CH0_vect(void);
+void USARTF1_DRE_vect(void);
+
+/************************************************************************/
+/* Timing                                                               */
+/************************************************************************/
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+typedef struct
+{
+	const char * suite;
+	const char * name;
+	void (*setup)(void);		// Called once after boot
+	void (*prepare)(void);		// Called before every sample, not timed
+	void (*run)(void);			// Timed
+	bool events;				// Expected to send events, the bench fails if it sends none
+} bench_case_t;
+
+typedef struct
+{
+	double mean_ns;
+	double latency_ns;			// Entry to the first core_func_send_event()
+	double min_ns, max_ns;
+	double events_per_call;
+} bench_result_t;
+
+#define BENCH_ROUNDS 5
+
+static uint32_t iterations = 200000;
+static double overhead_ns;
+
+static void nothing(void) {}
+
+/* Cost of timing an empty call, subtracted from the times of every case */
+static void bench_calibrate(void)
+{
+	void (* volatile run)(void) = nothing;
+	uint64_t total = 0;
+
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		uint64_t start = now_ns();
+		run();
+		total += now_ns() - start;
+	}
+
+	overhead_ns = (double)total / iterations;
+}
+
+/* Single calls shorter than the clock resolution can come out below the overhead */
+static double bench_net(uint64_t elapsed)
+{
+	return ((double)elapsed > overhead_ns) ? (double)elapsed - overhead_ns : 0;
+}
+
+static void bench_run(const bench_case_t * bench, bench_result_t * result)
+{
+	uint64_t min = UINT64_MAX, max = 0, total = 0, latency = 0;
+	uint32_t with_event = 0;
+
+	host_core_boot();
+	if (bench->setup)
+		bench->setup();
+	host_events_clear();
+
+	/* The mean is the best of several rounds, which keeps host scheduling noise out of it */
+	result->mean_ns = 1e12;
+
+	for (uint8_t round = 0; round < BENCH_ROUNDS; round++)
+	{
+		total = 0;
+
+		for (uint32_t i = 0; i < iterations / BENCH_ROUNDS; i++)
+		{
+			if (bench->prepare)
+				bench->prepare();
+
+			uint64_t start = now_ns();
+			bench->run();
+			uint64_t elapsed = now_ns() - start;
+
+			total += elapsed;
+			if (elapsed < min) min = elapsed;
+			if (elapsed > max) max = elapsed;
+		}
+
+		if ((double)total / (iterations / BENCH_ROUNDS) - overhead_ns < result->mean_ns)
+			result->mean_ns = (double)total / (iterations / BENCH_ROUNDS) - overhead_ns;
+	}
+
+	result->min_ns = bench_net(min);
+	result->max_ns = bench_net(max);
+	result->events_per_call = (double)host_events_count / (iterations / BENCH_ROUNDS * BENCH_ROUNDS);
+
+	/* Second pass with the events stamped, so the clock reads don't inflate the first one */
+	host_core_boot();
+	if (bench->setup)
+		bench->setup();
+	host_events_clock = now_ns;
+
+	for (uint32_t i = 0; i < iterations / 10 + 1; i++)
+	{
+		if (bench->prepare)
+			bench->prepare();
+
+		uint32_t events_before = host_events_count;
+
+		uint64_t start = now_ns();
+		bench->run();
+
+		if (host_events_count != events_before)
+		{
+			latency += host_events[events_before % HOST_EVENT_LOG_SIZE].host_ns - start;
+			with_event++;
+		}
+	}
+
+	host_events_clock = 0;
+
+	result->latency_ns = with_event ? (double)latency / with_event - overhead_ns / 2 : 0;
+}
+
+/************************************************************************/
+/* Baseline                                                             */
+/************************************************************************/
+/* Reads the mean and the events per call recorded for a case in a file written with -o */
+/* The file has one tab-separated line per case: name, mean ns, event ns, events per call */
+static bool baseline_read(const char * path, const char * name, double * mean, double * events)
+{
+	char line[256];
+	bool found = false;
+	FILE * file = fopen(path, "r");
+
+	if (!file)
+		return false;
+
+	while (fgets(line, sizeof(line), file))
+	{
+		char * tab = strchr(line, '\t');
+		double latency;
+
+		if (tab && (size_t)(tab - line) == strlen(name) && !strncmp(line, name, tab - line))
+		{
+			found = sscanf(tab + 1, "%lf %lf %lf", mean, &latency, events) == 3;
+			break;
+		}
+	}
+
+	fclose(file);
+	return found;
+}
+
+/************************************************************************/
+/* Cases: hot paths                                                     */
+/************************************************************************/
+static void write_outputs_set(void)
+{
+	uint16_t reg = B_PORT0_12V | B_LED0 | B_DO0;
+	app_write_REG_OUTPUTS_SET(&reg);
+}
+
+static void all_pulses_enable(void)
+{
+	uint16_t reg = 0x3FFF;
+	app_write_REG_OUTPUT_PULSE_EN(&reg);
+}
+
+static void all_pulses_start(void)
+{
+	uint16_t reg = 0x3CFF;		// Leave the RGBs out, they would call the WS2812 driver
+	app_write_REG_OUTPUTS_SET(&reg);
+}
+
+static void callback_500us(void)
+{
+	core_callback_t_500us();
+}
+
+static void callback_1ms(void)
+{
+	core_callback_t_before_exec();
+	core_callback_t_1ms();
+}
+
+static uint16_t freq;
+static uint8_t dcycle;
+
+static void write_freq(void)
+{
+	freq = (freq % 9999) + 1;
+	app_write_REG_FREQ_DO0(&freq);
+}
+
+static void write_dcycle(void)
+{
+	dcycle = (dcycle % 98) + 1;
+	app_write_REG_DCYCLE_DO0(&dcycle);
+}
+
+/************************************************************************/
+/* Cases: interrupts                                                    */
+/************************************************************************/
+static void events_off(void)
+{
+	app_regs.REG_EVNT_ENABLE = 0;
+}
+
+/* Without a hold-off every edge is reported */
+static void debounce_off(void)
+{
+	uint32_t holdoff[4] = {0, 0, 0, 0};
+	app_write_REG_DI_DEBOUNCE_RISE(holdoff);
+	app_write_REG_DI_DEBOUNCE_FALL(holdoff);
+}
+
+static void debounce_off_events_off(void)
+{
+	debounce_off();
+	events_off();
+}
+
+static void poke0_edge(void) { PORTD.IN ^= (1 << 4); }
+static void poke1_edge(void) { PORTE.IN ^= (1 << 4); }
+static void poke2_edge(void) { PORTF.IN ^= (1 << 4); }
+static void di3_edge(void) { PORTH.IN ^= (1 << 0); }
+
+static void adc_two_channels(void)
+{
+	PORTJ.IN |= (1 << 0);		// ADC1 available
+}
+
+static void adc_two_channels_events_off(void)
+{
+	adc_two_channels();
+	events_off();
+}
+
+static void adc_conversions(void)
+{
+	first_adc_channel = true;
+	ADCA_CH0_vect();
+	ADCA_CH0_vect();
+}
+
+static void cameras_start(void)
+{
+	uint8_t reg = B_EN_CAM_OUT0 | B_EN_CAM_OUT1;
+	app_write_REG_START_CAMERAS(&reg);
+}
+
+static void cameras_start_events_off(void)
+{
+	cameras_start();
+	events_off();
+}
+
+static void camera0_stop_request(void)
+{
+	cameras_start();
+	stop_camera_do0 = true;
+}
+
+static void camera1_stop_request(void)
+{
+	cameras_start();
+	stop_camera_do1 = true;
+}
+
+static void pwms_start(void)
+{
+	uint8_t reg = B_PWM_DO0 | B_PWM_DO1 | B_PWM_DO2 | B_PWM_DO3;
+	app_write_REG_PWM_START(&reg);
+}
+
+static void pwms_new_conf(void)
+{
+	is_new_timer_conf.pwm_do0 = true;
+	is_new_timer_conf.pwm_do1 = true;
+	is_new_timer_conf.pwm_do2 = true;
+	is_new_timer_conf.pwm_do3 = true;
+}
+
+static void serial_timestamp_start(void)
+{
+	uint8_t reg = B_EN_SRL_TSTAMP_PORT2;
+	app_write_REG_ENABLE_SERIAL_TIMESTAMP(&reg);
+}
+
+static void serial_timestamp_byte(void)
+{
+	timestamp_tx_index = 0;
+}
+
+static const bench_case_t benches[] = {
+	{"hot", "app_write_REG_OUTPUTS_SET",              0,                           0,                    write_outputs_set,    false},
+	{"hot", "core_callback_t_500us (idle)",           0,                           0,                    callback_500us,       false},
+	{"hot", "core_callback_t_500us (12 pulses)",      all_pulses_enable,           all_pulses_start,     callback_500us,       false},
+	{"hot", "core_callback_t_1ms + before_exec",      0,                           0,                    callback_1ms,         false},
+	{"hot", "app_write_REG_FREQ_DO0",                 0,                           0,                    write_freq,           false},
+	{"hot", "app_write_REG_DCYCLE_DO0",               0,                           0,                    write_dcycle,         false},
+
+	{"isr", "PORTD_INT0_vect",                        debounce_off,                poke0_edge,           PORTD_INT0_vect,      true},
+	{"isr", "PORTD_INT0_vect (no events)",            debounce_off_events_off,     poke0_edge,           PORTD_INT0_vect,      false},
+	{"isr", "PORTE_INT0_vect",                        debounce_off,                poke1_edge,           PORTE_INT0_vect,      true},
+	{"isr", "PORTE_INT0_vect (no events)",            debounce_off_events_off,     poke1_edge,           PORTE_INT0_vect,      false},
+	{"isr", "PORTF_INT0_vect",                        debounce_off,                poke2_edge,           PORTF_INT0_vect,      true},
+	{"isr", "PORTF_INT0_vect (no events)",            debounce_off_events_off,     poke2_edge,           PORTF_INT0_vect,      false},
+	{"isr", "PORTH_INT0_vect",                        0,                           di3_edge,             PORTH_INT0_vect,      true},
+	{"isr", "PORTH_INT0_vect (no events)",            events_off,                  di3_edge,             PORTH_INT0_vect,      false},
+	{"isr", "ADCA_CH0_vect x2",                       adc_two_channels,            0,                    adc_conversions,      true},
+	{"isr", "ADCA_CH0_vect x2 (no events)",           adc_two_channels_events_off, 0,                    adc_conversions,      false},
+	{"isr", "TCF0_OVF_vect (camera)",                 cameras_start,               0,                    TCF0_OVF_vect,        true},
+	{"isr", "TCF0_OVF_vect (camera, no events)",      cameras_start_events_off,    0,                    TCF0_OVF_vect,        false},
+	{"isr", "TCF0_OVF_vect (pwm update)",             pwms_start,                  pwms_new_conf,        TCF0_OVF_vect,        false},
+	{"isr", "TCF0_CCA_vect (camera stop)",            0,                           camera0_stop_request, TCF0_CCA_vect,        true},
+	{"isr", "TCE0_OVF_vect (camera)",                 cameras_start,               0,                    TCE0_OVF_vect,        true},
+	{"isr", "TCE0_OVF_vect (camera, no events)",      cameras_start_events_off,    0,                    TCE0_OVF_vect,        false},
+	{"isr", "TCE0_OVF_vect (pwm update)",             pwms_start,                  pwms_new_conf,        TCE0_OVF_vect,        false},
+	{"isr", "TCE0_CCA_vect (camera stop)",            0,                           camera1_stop_request, TCE0_CCA_vect,        true},
+	{"isr", "TCD0_OVF_vect (pwm update)",             pwms_start,                  pwms_new_conf,        TCD0_OVF_vect,        false},
+	{"isr", "TCC0_OVF_vect (pwm update)",             pwms_start,                  pwms_new_conf,        TCC0_OVF_vect,        false},
+	{"isr", "USARTF1_DRE_vect",                       serial_timestamp_start,      serial_timestamp_byte, USARTF1_DRE_vect,     false},
+};
+
+#define N_BENCHES (sizeof(benches) / sizeof(benches[0]))
+
+/************************************************************************/
+/* Main                                                                 */
+/************************************************************************/
+static void usage(void)
+{
+	printf("usage: bench [-n iterations] [-s suite] [-o results.tsv] [-c baseline.tsv] [filter]\n");
+	printf("  -s  run only the cases of a suite (hot, isr)\n");
+	printf("  -o  save the mean and the events per call of every case\n");
+	printf("  -c  compare against a saved baseline, fail if a case sends a different number of events\n");
+}
+
+int main(int argc, char * argv[])
+{
+	const char * filter = 0;
+	const char * suite = 0;
+	const char * output = 0;
+	const char * baseline = 0;
+	uint32_t failures = 0;
+	FILE * out = 0;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-n") && i + 1 < argc)
+			iterations = strtoul(argv[++i], 0, 0);
+		else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+			suite = argv[++i];
+		else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+			output = argv[++i];
+		else if (!strcmp(argv[i], "-c") && i + 1 < argc)
+			baseline = argv[++i];
+		else if (argv[i][0] == '-')
+		{
+			usage();
+			return 2;
+		}
+		else
+			filter = argv[i];
+	}
+
+	if (output && !(out = fopen(output, "w")))
+	{
+		perror(output);
+		return 2;
+	}
+
+	bench_calibrate();
+	printf("Timing overhead of %.1f ns removed from the times\n\n", overhead_ns);
+
+	printf("%-40s %8s %9s %9s %9s %9s", "case", "min ns", "mean ns", "max ns", "evt/call", "evt ns");
+	if (baseline)
+		printf(" %9s %9s", "baseline", "time");
+	printf("\n");
+
+	for (uint8_t i = 0; i < N_BENCHES; i++)
+	{
+		const bench_case_t * bench = &benches[i];
+		bench_result_t result;
+
+		if (suite && strcmp(bench->suite, suite))
+			continue;
+		if (filter && !strstr(bench->name, filter))
+			continue;
+
+		bench_run(bench, &result);
+
+		printf("%-40s %8.1f %9.1f %9.1f %9.3f %9.1f",
+			bench->name, result.min_ns, result.mean_ns, result.max_ns, result.events_per_call, result.latency_ns);
+
+		/* A case meant to send events that sends none no longer measures what it says */
+		if (bench->events && result.events_per_call == 0)
+		{
+			printf("  NO EVENTS");
+			failures++;
+		}
+
+		/* Host times move with the machine and its load, the events per call don't */
+		if (baseline)
+		{
+			double mean, events;
+
+			if (!baseline_read(baseline, bench->name, &mean, &events))
+				printf(" %9s %9s", "-", "-");
+			else
+			{
+				printf(" %9.3f %8.2fx", events, result.mean_ns / mean);
+
+				if (result.events_per_call < events - 0.0005 || result.events_per_call > events + 0.0005)
+				{
+					printf("  EVENTS CHANGED");
+					failures++;
+				}
+			}
+		}
+		printf("\n");
+
+		if (out)
+			fprintf(out, "%s\t%.1f\t%.1f\t%.3f\n", bench->name, result.mean_ns, result.latency_ns, result.events_per_call);
+	}
+
+	if (out)
+		fclose(out);
+
+	if (failures)
+	{
+		printf("\n%u case(s) sent no events or a different number than the baseline\n", failures);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,831 @@
+#define _XOPEN_SOURCE 600
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <termios.h>
+#include <sys/select.h>
+#include <sys/wait.h>
+
+#include "hwbp_core.h"
+#include "hwbp_core_types.h"
+#include "hwbp_core_regs.h"
+#include "app_ios_and_regs.h"
+#include "app_funcs.h"
+
+#include "hwbp_core_host.h"
+
+/************************************************************************/
+/* Behavior device emulator                                             */
+/*                                                                      */
+/* Runs the application on the fake core in real time and speaks the   */
+/* Harp binary protocol over a pseudo-terminal, so a host stack can     */
+/* connect to it as it would to a board. The common registers are      */
+/* emulated here, the application registers go through the firmware's  */
+/* own handlers. Pokes, DIOs, DI3, both ADC channels and the Port 2     */
+/* encoder are driven from a stimuli script.                            */
+/************************************************************************/
+extern AppRegs app_regs;
+extern uint8_t app_regs_type[];
+extern uint16_t app_regs_n_elements[];
+extern uint8_t *app_regs_pointer[];
+
+void PORTD_INT0_vect(void);
+void PORTE_INT0_vect(void);
+void PORTF_INT0_vect(void);
+void PORTH_INT0_vect(void);
+void ADCA_CH0_vect(void);
+void TCF1_OVF_vect(void);
+void TCF1_CCA_vect(void);
+
+#define TICK_US 500
+/* Falling further behind than this skips time instead of catching up */
+#define MAX_LAG_US 100000
+
+#define CORE_VERSION_H 1
+#define CORE_VERSION_L 15
+
+#define HARP_READ			1
+#define HARP_WRITE			2
+#define HARP_EVENT			3
+#define HARP_ERROR			0x08
+#define HARP_PORT_DEVICE	0xFF
+
+/************************************************************************/
+/* Stimuli                                                              */
+/************************************************************************/
+typedef struct
+{
+	PORT_t * port;
+	void (*isr)(void);
+	bool pending;			// Edge waiting for the port interrupt to be enabled
+} input_port_t;
+
+static input_port_t input_ports[] = {
+	{&PORTD, PORTD_INT0_vect, false},
+	{&PORTE, PORTE_INT0_vect, false},
+	{&PORTF, PORTF_INT0_vect, false},
+	{&PORTH, PORTH_INT0_vect, false},
+};
+
+typedef struct
+{
+	const char * name;
+	uint8_t port;			// Index into input_ports
+	uint8_t pin;
+	double period_us;		// Between edges, 0 when not driven
+	double next_us;
+} input_t;
+
+static input_t inputs[] = {
+	{"poke0", 0, 4, 0, 0},
+	{"poke1", 1, 4, 0, 0},
+	{"poke2", 2, 4, 0, 0},
+	{"dio0", 0, 5, 0, 0},
+	{"dio1", 1, 5, 0, 0},
+	{"dio2", 2, 5, 0, 0},
+	{"di3", 3, 0, 0, 0},
+};
+
+#define N_INPUTS (sizeof(inputs) / sizeof(inputs[0]))
+
+typedef enum
+{
+	WAVE_DC,
+	WAVE_SINE,
+	WAVE_SQUARE,
+	WAVE_RAMP
+} wave_t;
+
+typedef struct
+{
+	wave_t wave;
+	double freq_hz;
+	double min, max;		// Raw 12-bit ADC counts
+} adc_input_t;
+
+static adc_input_t adc_inputs[2];
+
+static double encoder_counts_per_s;
+static double encoder_position;
+
+static double rate_scale = 1;
+
+static void stimuli_usage(void)
+{
+	fprintf(stderr, "stimuli, one per line ('#' starts a comment):\n");
+	fprintf(stderr, "  poke<0-2> | dio<0-2> | di3 <edges per second>\n");
+	fprintf(stderr, "  adc<0-1> <dc|sine|square|ramp> <frequency Hz> <min> <max>   (12-bit counts)\n");
+	fprintf(stderr, "  encoder <counts per second>\n");
+}
+
+static bool stimuli_load(const char * path)
+{
+	char line[256];
+	unsigned line_n = 0;
+	FILE * file = fopen(path, "r");
+
+	if (!file)
+	{
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		return false;
+	}
+
+	while (fgets(line, sizeof(line), file))
+	{
+		char name[16], wave[16];
+		double a, b, c;
+		int n;
+		bool ok = false;
+
+		line_n++;
+
+		if (strchr(line, '#'))
+			*strchr(line, '#') = 0;
+
+		n = sscanf(line, "%15s", name);
+		if (n < 1)
+			continue;
+
+		for (uint8_t i = 0; i < N_INPUTS; i++)
+		{
+			if (!strcmp(name, inputs[i].name) && sscanf(line, "%*s %lf", &a) == 1 && a >= 0)
+			{
+				inputs[i].period_us = (a > 0) ? 1e6 / (a * rate_scale) : 0;
+				inputs[i].next_us = inputs[i].period_us;
+				ok = true;
+			}
+		}
+
+		if (!strcmp(name, "adc0") || !strcmp(name, "adc1"))
+		{
+			adc_input_t * adc = &adc_inputs[name[3] - '0'];
+
+			if (sscanf(line, "%*s %15s %lf %lf %lf", wave, &a, &b, &c) == 4 && b >= 0 && c <= 4095)
+			{
+				ok = true;
+
+				if (!strcmp(wave, "dc"))
+					adc->wave = WAVE_DC;
+				else if (!strcmp(wave, "sine"))
+					adc->wave = WAVE_SINE;
+				else if (!strcmp(wave, "square"))
+					adc->wave = WAVE_SQUARE;
+				else if (!strcmp(wave, "ramp"))
+					adc->wave = WAVE_RAMP;
+				else
+					ok = false;
+
+				adc->freq_hz = a * rate_scale;
+				adc->min = b;
+				adc->max = c;
+			}
+		}
+
+		if (!strcmp(name, "encoder") && sscanf(line, "%*s %lf", &a) == 1)
+		{
+			encoder_counts_per_s = a * rate_scale;
+			ok = true;
+		}
+
+		if (!ok)
+		{
+			fprintf(stderr, "%s:%u: can't parse '%s'\n", path, line_n, name);
+			stimuli_usage();
+			fclose(file);
+			return false;
+		}
+	}
+
+	fclose(file);
+	return true;
+}
+
+static uint16_t adc_sample(const adc_input_t * adc, double now_us)
+{
+	double phase = fmod(now_us * 1e-6 * adc->freq_hz, 1);
+	double level;
+
+	switch (adc->wave)
+	{
+		case WAVE_SINE:   level = 0.5 + 0.5 * sin(2 * M_PI * phase); break;
+		case WAVE_SQUARE: level = (phase < 0.5) ? 1 : 0; break;
+		case WAVE_RAMP:   level = phase; break;
+		default:          level = 0; break;
+	}
+
+	return (uint16_t)(adc->min + level * (adc->max - adc->min) + 0.5);
+}
+
+/* ADC1 is wired, which also enables the DI3 interrupt */
+static void emulator_boot_inputs(void)
+{
+	PORTJ.IN |= (1 << 0);
+}
+
+static void stimuli_run(double now_us)
+{
+	for (uint8_t i = 0; i < N_INPUTS; i++)
+	{
+		while (inputs[i].period_us && now_us >= inputs[i].next_us)
+		{
+			inputs[i].next_us += inputs[i].period_us;
+			input_ports[inputs[i].port].port->IN ^= (1 << inputs[i].pin);
+			input_ports[inputs[i].port].pending = true;
+		}
+	}
+
+	/* An edge that arrives while the poke input filter has the interrupt disabled stays pending */
+	for (uint8_t i = 0; i < sizeof(input_ports) / sizeof(input_ports[0]); i++)
+	{
+		if (input_ports[i].pending && (input_ports[i].port->INTCTRL & PORT_INT0LVL_gm))
+		{
+			input_ports[i].pending = false;
+			input_ports[i].isr();
+		}
+	}
+
+	encoder_position += encoder_counts_per_s * TICK_US * 1e-6;
+	TCD1_CNT += (int16_t)encoder_position;
+	encoder_position -= (int16_t)encoder_position;
+}
+
+/* Completes the conversions the application started, channel 0 and then channel 2 */
+static void adc_run(double now_us)
+{
+	for (uint8_t i = 0; i < 2 && (ADCA_CH0_CTRL & ADC_CH_START_bm); i++)
+	{
+		ADCA_CH0_CTRL &= ~ADC_CH_START_bm;
+		ADCA_CH0_RES = adc_sample(&adc_inputs[(ADCA_CH0_MUXCTRL >> 3) ? 1 : 0], now_us);
+		ADCA_CH0_vect();
+	}
+}
+
+/* Runs TCF1 through the tick at 4 counts per microsecond, entering its */
+/* interrupts at the counts where the board would                       */
+static void tcf1_run(void)
+{
+	uint32_t counts = TICK_US * 4;
+
+	/* Flags are cleared by writing ones on the board, the ISRs below never leave one set */
+	TCF1.INTFLAGS = 0;
+
+	if (TCF1.CTRLA != TC_CLKSEL_DIV8_gc)
+		return;
+
+	while (counts)
+	{
+		uint32_t step = counts;
+		uint32_t to_ovf = 0x10000 - TCF1.CNT;
+		uint32_t to_cca = (uint16_t)(TCF1.CCA - TCF1.CNT);
+		bool ovf = false, cca = false;
+
+		if (to_cca == 0)
+			to_cca = 0x10000;
+
+		if ((TCF1.INTCTRLB & TC_CCAINTLVL_gm) && to_cca <= step)
+		{
+			step = to_cca;
+			cca = true;
+		}
+
+		if ((TCF1.INTCTRLA & TC_OVFINTLVL_gm) && to_ovf <= step)
+		{
+			cca = cca && to_ovf == step;
+			step = to_ovf;
+			ovf = true;
+		}
+
+		TCF1.CNT = (uint16_t)(TCF1.CNT + step);
+		counts -= step;
+
+		/* Same level, the overflow has the lower vector */
+		if (ovf)
+			TCF1_OVF_vect();
+		if (cca)
+			TCF1_CCA_vect();
+	}
+}
+
+/************************************************************************/
+/* Harp protocol                                                        */
+/************************************************************************/
+static int master_fd = -1;
+
+/* Same size as the board's TX buffer, whole messages that don't fit are dropped */
+static uint8_t tx_buffer[TX_BUFFER_SIZE];
+static uint16_t tx_length;
+static uint32_t tx_dropped;
+
+static uint8_t rx_buffer[2 * (MAX_PACKET_SIZE + 2)];
+static uint16_t rx_length;
+
+static void harp_send(uint8_t message_type, uint8_t add, uint8_t type, uint32_t second, uint16_t usecond, const void * payload, uint8_t length)
+{
+	uint8_t message[MAX_PACKET_SIZE + 2];
+	uint8_t checksum = 0;
+	uint16_t size = HOST_HARP_MESSAGE_OVERHEAD + length;
+
+	message[0] = message_type;
+	message[1] = length + 10;
+	message[2] = add;
+	message[3] = HARP_PORT_DEVICE;
+	message[4] = type | MSK_TIMESTAMP_AT_PAYLOAD;
+	memcpy(&message[5], &second, 4);
+	memcpy(&message[9], &usecond, 2);
+	memcpy(&message[11], payload, length);
+
+	for (uint16_t i = 0; i < size - 1; i++)
+		checksum += message[i];
+	message[size - 1] = checksum;
+
+	if (tx_length + size > TX_BUFFER_SIZE)
+	{
+		tx_dropped++;
+		return;
+	}
+
+	memcpy(&tx_buffer[tx_length], message, size);
+	tx_length += size;
+}
+
+static void harp_flush(void)
+{
+	ssize_t n = (tx_length) ? write(master_fd, tx_buffer, tx_length) : 0;
+
+	if (n <= 0)
+		return;
+
+	tx_length -= n;
+	memmove(tx_buffer, &tx_buffer[n], tx_length);
+}
+
+/************************************************************************/
+/* Common registers                                                     */
+/************************************************************************/
+typedef struct
+{
+	uint8_t type;
+	uint8_t n_elements;
+	void * value;
+	bool writable;
+} core_reg_t;
+
+static uint8_t core_versions[7];
+static uint32_t core_timestamp_second;
+static uint16_t core_timestamp_micro;
+static uint8_t core_operation_ctrl;
+static uint8_t core_reset;
+static uint8_t core_device_name[25];
+static uint16_t core_serial_number;
+static uint8_t core_clock_config;
+static uint8_t core_timestamp_offset;
+
+static core_reg_t core_regs[COMMON_BANK_ADD_MAX + 1] = {
+	[ADD_R_WHO_AM_I]         = {TYPE_U16, 1, &host_device.who_am_i, false},
+	[ADD_R_HW_VERSION_H]     = {TYPE_U8, 1, &core_versions[0], false},
+	[ADD_R_HW_VERSION_L]     = {TYPE_U8, 1, &core_versions[1], false},
+	[ADD_R_ASSEMBLY_VERSION] = {TYPE_U8, 1, &core_versions[2], false},
+	[ADD_R_CORE_VERSION_H]   = {TYPE_U8, 1, &core_versions[3], false},
+	[ADD_R_CORE_VERSION_L]   = {TYPE_U8, 1, &core_versions[4], false},
+	[ADD_R_FW_VERSION_H]     = {TYPE_U8, 1, &core_versions[5], false},
+	[ADD_R_FW_VERSION_L]     = {TYPE_U8, 1, &core_versions[6], false},
+	[ADD_R_TIMESTAMP_SECOND] = {TYPE_U32, 1, &core_timestamp_second, true},
+	[ADD_R_TIMESTAMP_MICRO]  = {TYPE_U16, 1, &core_timestamp_micro, false},
+	[ADD_R_OPERATION_CTRL]   = {TYPE_U8, 1, &core_operation_ctrl, true},
+	[ADD_R_RESET_DEV]        = {TYPE_U8, 1, &core_reset, true},
+	[ADD_R_DEVICE_NAME]      = {TYPE_U8, 25, core_device_name, true},
+	[ADD_R_SERIAL_NUMBER]    = {TYPE_U16, 1, &core_serial_number, true},
+	[ADD_R_CONFIG]           = {TYPE_U8, 1, &core_clock_config, true},
+	[ADD_R_TIMESTAMP_OFFSET] = {TYPE_U8, 1, &core_timestamp_offset, true},
+};
+
+static bool device_is_standby(void)
+{
+	return (core_operation_ctrl & MSK_OP_MODE) == GM_OP_MODE_STANDBY;
+}
+
+static void emulator_event(const host_event_t * event)
+{
+	if (device_is_standby())
+		return;
+
+	harp_send(HARP_EVENT, event->add, event->type, event->second, event->usecond, event->payload, event->length);
+}
+
+static void emulator_boot(void)
+{
+	host_boot_inputs = emulator_boot_inputs;
+	host_events_sink = emulator_event;
+	host_events_capture = true;
+
+	host_core_boot();
+
+	core_versions[0] = host_device.hw_h;
+	core_versions[1] = host_device.hw_l;
+	core_versions[2] = host_device.assembly;
+	core_versions[3] = CORE_VERSION_H;
+	core_versions[4] = CORE_VERSION_L;
+	core_versions[5] = host_device.fw_h;
+	core_versions[6] = host_device.fw_l;
+
+	core_operation_ctrl = GM_OP_MODE_STANDBY | B_VISUALEN | B_OPLEDEN;
+	core_reset = 0;
+	memset(core_device_name, 0, sizeof(core_device_name));
+	memcpy(core_device_name, host_device.name, strlen(host_device.name));
+	core_clock_config = 0;		// Neither able to repeat nor to generate the clock
+	core_timestamp_offset = 0;
+}
+
+static void core_reply(uint8_t message_type, uint8_t add)
+{
+	core_reg_t * reg = &core_regs[add];
+
+	if (core_operation_ctrl & B_MUTE_RPL)
+		return;
+
+	core_timestamp_second = host_timestamp_second;
+	core_timestamp_micro = host_timestamp_usecond;
+
+	harp_send(message_type, add, reg->type, host_timestamp_second, host_timestamp_usecond, reg->value, (reg->type & MSK_TYPE_LEN) * reg->n_elements);
+}
+
+static void app_reply(uint8_t message_type, uint8_t add)
+{
+	uint8_t index = add - APP_REGS_ADD_MIN;
+
+	if (core_operation_ctrl & B_MUTE_RPL)
+		return;
+
+	harp_send(message_type, add, app_regs_type[index], host_timestamp_second, host_timestamp_usecond,
+		app_regs_pointer[index], (app_regs_type[index] & MSK_TYPE_LEN) * app_regs_n_elements[index]);
+}
+
+static void dump_registers(void)
+{
+	for (uint8_t add = 0; add <= COMMON_BANK_ADD_MAX; add++)
+		core_reply(HARP_READ, add);
+
+	for (uint8_t add = APP_REGS_ADD_MIN; add <= APP_REGS_ADD_MAX; add++)
+	{
+		core_read_app_register(add, app_regs_type[add - APP_REGS_ADD_MIN]);
+		app_reply(HARP_READ, add);
+	}
+}
+
+static bool core_write(uint8_t add, const uint8_t * payload)
+{
+	uint8_t previous_mode = core_operation_ctrl & MSK_OP_MODE;
+
+	switch (add)
+	{
+		case ADD_R_TIMESTAMP_SECOND:
+			memcpy(&host_timestamp_second, payload, 4);
+			return true;
+
+		case ADD_R_OPERATION_CTRL:
+			core_operation_ctrl = payload[0];
+
+			if ((core_operation_ctrl & MSK_OP_MODE) != previous_mode)
+			{
+				switch (core_operation_ctrl & MSK_OP_MODE)
+				{
+					case GM_OP_MODE_STANDBY: core_callback_device_to_standby(); break;
+					case GM_OP_MODE_ACTIVE:  core_callback_device_to_active(); break;
+					case GM_OP_MODE_SPEED:   core_callback_device_to_speed(); break;
+				}
+			}
+			return true;
+
+		case ADD_R_RESET_DEV:
+			core_reset = payload[0] & (B_RST_DEF | B_RST_EE | B_SAVE | B_NAME_TO_DEFAULT);
+
+			if (core_reset & B_NAME_TO_DEFAULT)
+			{
+				memset(core_device_name, 0, sizeof(core_device_name));
+				memcpy(core_device_name, host_device.name, strlen(host_device.name));
+			}
+			return true;
+
+		default:
+			memcpy(core_regs[add].value, payload, (core_regs[add].type & MSK_TYPE_LEN) * core_regs[add].n_elements);
+			return true;
+	}
+}
+
+static void harp_dispatch(const uint8_t * message)
+{
+	uint8_t message_type = message[0];
+	uint8_t add = message[2];
+	uint8_t type = message[4] & ~MSK_TIMESTAMP_AT_PAYLOAD;
+	const uint8_t * payload = &message[5];
+	uint8_t length = message[1] - 4;
+	uint8_t element_size = type & MSK_TYPE_LEN;
+
+	if (message[4] & MSK_TIMESTAMP_AT_PAYLOAD)
+	{
+		payload += 6;
+		length -= 6;
+	}
+
+	if (message_type != HARP_READ && message_type != HARP_WRITE)
+		return;
+
+	if (add <= COMMON_BANK_ADD_MAX && core_regs[add].value)
+	{
+		core_reg_t * reg = &core_regs[add];
+		bool ok = (type == reg->type);
+
+		if (ok && message_type == HARP_WRITE)
+			ok = reg->writable && length == (reg->type & MSK_TYPE_LEN) * reg->n_elements && core_write(add, payload);
+
+		core_reply(ok ? message_type : (message_type | HARP_ERROR), add);
+
+		if (ok && add == ADD_R_OPERATION_CTRL && (core_operation_ctrl & B_DUMP))
+		{
+			core_operation_ctrl &= ~B_DUMP;
+			dump_registers();
+		}
+
+		if (ok && add == ADD_R_RESET_DEV && (core_reset & (B_RST_DEF | B_RST_EE)))
+			emulator_boot();
+
+		return;
+	}
+
+	if (add >= APP_REGS_ADD_MIN && add <= APP_REGS_ADD_MAX)
+	{
+		bool ok;
+
+		if (message_type == HARP_READ)
+			ok = core_read_app_register(add, type);
+		else
+			ok = element_size && (length % element_size) == 0 && core_write_app_register(add, type, (uint8_t*)payload, length / element_size);
+
+		app_reply(ok ? message_type : (message_type | HARP_ERROR), add);
+		return;
+	}
+
+	/* Unknown address, reply with the error and no payload */
+	if (!(core_operation_ctrl & B_MUTE_RPL))
+		harp_send(message_type | HARP_ERROR, add, type, host_timestamp_second, host_timestamp_usecond, 0, 0);
+}
+
+static void harp_receive(void)
+{
+	ssize_t n = read(master_fd, &rx_buffer[rx_length], sizeof(rx_buffer) - rx_length);
+
+	if (n <= 0)
+		return;
+
+	rx_length += n;
+
+	while (rx_length >= 2)
+	{
+		uint16_t size = rx_buffer[1] + 2;
+		uint8_t checksum = 0;
+
+		/* The shortest command is a read: add, port, type and checksum */
+		if (size < 6)
+		{
+			memmove(rx_buffer, &rx_buffer[1], --rx_length);
+			continue;
+		}
+
+		if (rx_length < size)
+			break;
+
+		for (uint16_t i = 0; i < size - 1; i++)
+			checksum += rx_buffer[i];
+
+		/* Resynchronize one byte at a time on a bad checksum */
+		if (checksum != rx_buffer[size - 1])
+		{
+			memmove(rx_buffer, &rx_buffer[1], --rx_length);
+			continue;
+		}
+
+		harp_dispatch(rx_buffer);
+
+		rx_length -= size;
+		memmove(rx_buffer, &rx_buffer[size], rx_length);
+	}
+}
+
+/************************************************************************/
+/* Pseudo-terminal                                                      */
+/************************************************************************/
+static volatile sig_atomic_t running = 1;
+
+static void on_signal(int sig)
+{
+	running = 0;
+}
+
+static int pty_open(const char * link)
+{
+	struct termios tio;
+	int slave_fd;
+
+	master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+
+	if (master_fd < 0 || grantpt(master_fd) || unlockpt(master_fd))
+	{
+		perror("posix_openpt");
+		return -1;
+	}
+
+	/* Keep the slave open so the master doesn't see a hangup between host connections */
+	slave_fd = open(ptsname(master_fd), O_RDWR | O_NOCTTY);
+
+	if (slave_fd < 0)
+	{
+		perror(ptsname(master_fd));
+		return -1;
+	}
+
+	tcgetattr(slave_fd, &tio);
+	cfmakeraw(&tio);
+	tcsetattr(slave_fd, TCSANOW, &tio);
+
+	fcntl(master_fd, F_SETFL, fcntl(master_fd, F_GETFL) | O_NONBLOCK);
+
+	if (link)
+	{
+		unlink(link);
+
+		if (symlink(ptsname(master_fd), link))
+		{
+			perror(link);
+			return -1;
+		}
+	}
+
+	return slave_fd;
+}
+
+static double now_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+static int emulator_run(const char * link, uint16_t serial_number)
+{
+	double start_us, device_us = 0;
+	uint32_t previous_second;
+
+	if (pty_open(link) < 0)
+		return 1;
+
+	emulator_boot();
+	core_serial_number = serial_number;
+
+	printf("Behavior %u on %s%s%s\n", serial_number, ptsname(master_fd), link ? " -> " : "", link ? link : "");
+	fflush(stdout);
+
+	start_us = now_us();
+
+	while (running)
+	{
+		double elapsed_us = now_us() - start_us;
+		struct timeval timeout;
+		fd_set read_fds, write_fds;
+
+		if (elapsed_us - device_us > MAX_LAG_US)
+		{
+			start_us += elapsed_us - device_us;
+			elapsed_us = device_us;
+		}
+
+		while (device_us <= elapsed_us)
+		{
+			previous_second = host_timestamp_second;
+
+			stimuli_run(device_us);
+			host_core_tick_500us();
+			tcf1_run();
+			adc_run(device_us);
+
+			if (host_timestamp_second != previous_second && (core_operation_ctrl & B_ALIVE_EN) && !device_is_standby())
+			{
+				core_timestamp_second = host_timestamp_second;
+				harp_send(HARP_EVENT, ADD_R_TIMESTAMP_SECOND, TYPE_U32, host_timestamp_second, host_timestamp_usecond, &core_timestamp_second, 4);
+			}
+
+			device_us += TICK_US;
+		}
+
+		harp_flush();
+
+		FD_ZERO(&read_fds);
+		FD_ZERO(&write_fds);
+		FD_SET(master_fd, &read_fds);
+		if (tx_length)
+			FD_SET(master_fd, &write_fds);
+		timeout.tv_sec = 0;
+		timeout.tv_usec = (long)(device_us - elapsed_us);
+
+		if (select(master_fd + 1, &read_fds, &write_fds, 0, &timeout) > 0)
+		{
+			if (FD_ISSET(master_fd, &read_fds))
+				harp_receive();
+			harp_flush();
+		}
+	}
+
+	if (link)
+		unlink(link);
+
+	printf("Behavior %u stopped, %u messages dropped with the host not reading\n", serial_number, tx_dropped);
+	return 0;
+}
+
+/************************************************************************/
+/* Main                                                                 */
+/************************************************************************/
+static void usage(void)
+{
+	printf("usage: emulator [-s stimuli] [-x rate scale] [-l link] [-n instances]\n");
+	printf("  -s  stimuli script driving the inputs (see below)\n");
+	printf("  -x  multiply every stimulus rate and frequency (default 1)\n");
+	printf("  -l  create a symlink to the pty, numbered when running several instances\n");
+	printf("  -n  run this many independent devices, one process and pty each (default 1)\n\n");
+	fflush(stdout);
+	stimuli_usage();
+}
+
+int main(int argc, char * argv[])
+{
+	const char * stimuli = 0;
+	const char * link = 0;
+	uint32_t instances = 1;
+	struct sigaction action;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-s") && i + 1 < argc)
+			stimuli = argv[++i];
+		else if (!strcmp(argv[i], "-x") && i + 1 < argc)
+			rate_scale = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-l") && i + 1 < argc)
+			link = argv[++i];
+		else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+			instances = strtoul(argv[++i], 0, 0);
+		else
+		{
+			usage();
+			return 2;
+		}
+	}
+
+	if (rate_scale <= 0 || instances == 0)
+	{
+		usage();
+		return 2;
+	}
+
+	if (stimuli && !stimuli_load(stimuli))
+		return 2;
+
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = on_signal;
+	sigaction(SIGINT, &action, 0);
+	sigaction(SIGTERM, &action, 0);
+
+	if (instances == 1)
+		return emulator_run(link, 0);
+
+	for (uint32_t i = 0; i < instances; i++)
+	{
+		if (fork() == 0)
+		{
+			char numbered[256];
+
+			if (link)
+				snprintf(numbered, sizeof(numbered), "%s%u", link, i);
+
+			return emulator_run(link ? numbered : 0, i);
+		}
+	}
+
+	/* Stop the devices along with this process, whoever the signal was sent to */
+	for (bool forwarded = false; wait(0) > 0 || errno == EINTR; )
+	{
+		if (!running && !forwarded)
+		{
+			forwarded = true;
+			kill(0, SIGTERM);
+		}
+	}
+
+	return 0;
+}
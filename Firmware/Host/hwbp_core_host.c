@@ -0,0 +1,507 @@
+#include <string.h>
+#include <math.h>
+
+#include "hwbp_core.h"
+#include "hwbp_core_types.h"
+#include "hwbp_core_com.h"
+#include "cpu.h"
+#include "app.h"
+#include "app_funcs.h"
+#include "WS2812S.h"
+
+#include "hwbp_core_host.h"
+
+/************************************************************************/
+/* Declare application registers                                        */
+/************************************************************************/
+extern uint8_t app_regs_type[];
+extern uint16_t app_regs_n_elements[];
+extern uint8_t *app_regs_pointer[];
+
+/************************************************************************/
+/* Peripherals                                                          */
+/************************************************************************/
+PORT_t host_PORTA, host_PORTB, host_PORTC, host_PORTD, host_PORTE, host_PORTF;
+PORT_t host_PORTH, host_PORTJ, host_PORTK, host_PORTQ, host_PORTR;
+TC0_t host_TCC0, host_TCD0, host_TCE0, host_TCF0;
+TC1_t host_TCC1, host_TCD1, host_TCE1, host_TCF1;
+ADC_t host_ADCA, host_ADCB;
+DAC_t host_DACA, host_DACB;
+USART_t host_USARTC0, host_USARTC1, host_USARTD0, host_USARTD1;
+USART_t host_USARTE0, host_USARTE1, host_USARTF0, host_USARTF1;
+EVSYS_t host_EVSYS;
+DMA_t host_DMA;
+PMIC_t host_PMIC;
+register8_t host_SREG;
+
+double host_delay_us_total;
+
+static PORT_t * const host_ports[] = {
+	&host_PORTA, &host_PORTB, &host_PORTC, &host_PORTD, &host_PORTE, &host_PORTF,
+	&host_PORTH, &host_PORTJ, &host_PORTK, &host_PORTQ, &host_PORTR
+};
+
+#define HOST_N_PORTS (sizeof(host_ports) / sizeof(host_ports[0]))
+
+static void host_peripherals_reset(void)
+{
+	for (uint8_t i = 0; i < HOST_N_PORTS; i++)
+		memset((void*)host_ports[i], 0, sizeof(PORT_t));
+
+	memset((void*)&host_TCC0, 0, sizeof(TC0_t)); memset((void*)&host_TCD0, 0, sizeof(TC0_t));
+	memset((void*)&host_TCE0, 0, sizeof(TC0_t)); memset((void*)&host_TCF0, 0, sizeof(TC0_t));
+	memset((void*)&host_TCC1, 0, sizeof(TC1_t)); memset((void*)&host_TCD1, 0, sizeof(TC1_t));
+	memset((void*)&host_TCE1, 0, sizeof(TC1_t)); memset((void*)&host_TCF1, 0, sizeof(TC1_t));
+	memset((void*)&host_ADCA, 0, sizeof(ADC_t)); memset((void*)&host_ADCB, 0, sizeof(ADC_t));
+	memset((void*)&host_DACA, 0, sizeof(DAC_t)); memset((void*)&host_DACB, 0, sizeof(DAC_t));
+	memset((void*)&host_USARTC0, 0, sizeof(USART_t)); memset((void*)&host_USARTC1, 0, sizeof(USART_t));
+	memset((void*)&host_USARTD0, 0, sizeof(USART_t)); memset((void*)&host_USARTD1, 0, sizeof(USART_t));
+	memset((void*)&host_USARTE0, 0, sizeof(USART_t)); memset((void*)&host_USARTE1, 0, sizeof(USART_t));
+	memset((void*)&host_USARTF0, 0, sizeof(USART_t)); memset((void*)&host_USARTF1, 0, sizeof(USART_t));
+	memset((void*)&host_EVSYS, 0, sizeof(EVSYS_t));
+	memset((void*)&host_DMA, 0, sizeof(DMA_t));
+	memset((void*)&host_PMIC, 0, sizeof(PMIC_t));
+
+	/* The ADC conversions complete immediately */
+	host_ADCA.CH0.INTFLAGS = ADC_CH_CHIF_bm;
+}
+
+void host_ports_latch(void)
+{
+	for (uint8_t i = 0; i < HOST_N_PORTS; i++)
+	{
+		PORT_t * port = host_ports[i];
+
+		port->DIR = ((port->DIR | port->DIRSET) & ~port->DIRCLR) ^ port->DIRTGL;
+		port->OUT = ((port->OUT | port->OUTSET) & ~port->OUTCLR) ^ port->OUTTGL;
+		port->DIRSET = port->DIRCLR = port->DIRTGL = 0;
+		port->OUTSET = port->OUTCLR = port->OUTTGL = 0;
+	}
+}
+
+void host_set_pin(PORT_t * port, uint8_t pin, bool level)
+{
+	if (level)
+		port->IN |= (1 << pin);
+	else
+		port->IN &= ~(1 << pin);
+}
+
+/************************************************************************/
+/* Event log                                                            */
+/************************************************************************/
+host_event_t host_events[HOST_EVENT_LOG_SIZE];
+uint32_t host_events_count;
+bool host_events_capture = true;
+uint64_t (*host_events_clock)(void);
+void (*host_events_sink)(const host_event_t * event);
+
+void host_events_clear(void)
+{
+	host_events_count = 0;
+}
+
+host_event_t * host_events_last(void)
+{
+	if (host_events_count == 0)
+		return 0;
+
+	return &host_events[(host_events_count - 1) % HOST_EVENT_LOG_SIZE];
+}
+
+/************************************************************************/
+/* Harp UART TX path                                                    */
+/************************************************************************/
+host_uart_t host_uart;
+
+/* Write and read indexes of the core's TX buffer, kept in step with the model */
+uint16_t hwbp_uart_head;
+uint16_t hwbp_uart_tail;
+
+static void host_uart_update_tail(void)
+{
+	uint16_t level = (uint16_t)ceil(host_uart.level);
+
+	hwbp_uart_tail = (hwbp_uart_head + TX_BUFFER_SIZE - level) % TX_BUFFER_SIZE;
+}
+
+void host_uart_reset(uint16_t size, uint32_t bytes_per_second, double late_us)
+{
+	memset(&host_uart, 0, sizeof(host_uart));
+	host_uart.size = size;
+	host_uart.bytes_per_second = bytes_per_second;
+	host_uart.late_us = late_us;
+
+	hwbp_uart_head = 0;
+	hwbp_uart_tail = 0;
+}
+
+void host_uart_drain(double us)
+{
+	host_uart.level -= us * host_uart.bytes_per_second / 1e6;
+
+	if (host_uart.level < 0)
+		host_uart.level = 0;
+
+	host_uart_update_tail();
+}
+
+static void host_uart_queue(uint8_t length)
+{
+	double delay_us;
+
+	host_uart.bytes += length;
+
+	if (host_uart.level + length > host_uart.size)
+	{
+		host_uart.dropped++;
+		return;
+	}
+
+	delay_us = host_uart.level * 1e6 / host_uart.bytes_per_second;
+
+	if (delay_us > host_uart.max_delay_us)
+		host_uart.max_delay_us = delay_us;
+	if (delay_us > host_uart.late_us)
+		host_uart.late++;
+
+	host_uart.level += length;
+	host_uart.queued++;
+
+	hwbp_uart_head = (hwbp_uart_head + length) % TX_BUFFER_SIZE;
+	host_uart_update_tail();
+
+	if (host_uart.level > host_uart.high_water)
+		host_uart.high_water = (uint16_t)(host_uart.level + 0.5);
+}
+
+/************************************************************************/
+/* Core emulation                                                       */
+/************************************************************************/
+uint32_t host_timestamp_second;
+uint16_t host_timestamp_usecond;
+
+static uint32_t user_timestamp_second;
+static uint16_t user_timestamp_usecond;
+
+static uint32_t host_us_in_second;
+static bool host_tick_is_1ms = true;
+
+static uint8_t * host_app_regs;
+static uint16_t host_app_regs_size;
+static uint8_t host_app_regs_count;
+
+host_device_t host_device;
+void (*host_boot_inputs)(void);
+
+void core_func_start_core (
+	const uint16_t who_am_i,
+	const uint8_t hwH,
+	const uint8_t hwL,
+	const uint8_t fwH,
+	const uint8_t fwL,
+	const uint8_t assembly,
+	uint8_t *pointer_to_app_regs,
+	const uint16_t app_mem_size_to_save,
+	const uint8_t num_of_app_registers,
+	const uint8_t *device_name,
+	const bool device_is_able_to_repeat_clock,
+	const bool device_is_able_to_generate_clock,
+	const uint8_t default_timestamp_offset)
+{
+	host_app_regs = pointer_to_app_regs;
+	host_app_regs_size = app_mem_size_to_save;
+	host_app_regs_count = num_of_app_registers;
+
+	host_device.who_am_i = who_am_i;
+	host_device.hw_h = hwH;
+	host_device.hw_l = hwL;
+	host_device.fw_h = fwH;
+	host_device.fw_l = fwL;
+	host_device.assembly = assembly;
+	strncpy(host_device.name, (const char*)device_name, sizeof(host_device.name) - 1);
+
+	core_callback_define_clock_default();
+	core_callback_initialize_hardware();
+	core_callback_reset_registers();
+	core_callback_registers_were_reinitialized();
+}
+
+void host_core_boot(void)
+{
+	host_peripherals_reset();
+	host_events_clear();
+
+	if (host_boot_inputs)
+		host_boot_inputs();
+
+	host_timestamp_second = 0;
+	host_timestamp_usecond = 0;
+	host_us_in_second = 0;
+	host_tick_is_1ms = true;
+	host_delay_us_total = 0;
+
+	hwbp_app_initialize();
+	host_ports_latch();
+}
+
+void TCC1_CCB_vect(void);
+
+/* Whether a count going from previous to now passed the compare value */
+static bool host_compare_passed(uint16_t previous, uint16_t now, uint16_t compare)
+{
+	if (now >= previous)
+		return previous < compare && compare <= now;
+
+	return previous < compare || compare <= now;
+}
+
+void host_core_tick_500us(void)
+{
+	bool new_second = false;
+	uint16_t previous_usecond = host_timestamp_usecond;
+
+	host_us_in_second += 500;
+
+	if (host_tick_is_1ms && host_us_in_second >= 1000000)
+	{
+		host_us_in_second -= 1000000;
+		host_timestamp_second++;
+		new_second = true;
+	}
+
+	host_timestamp_usecond = host_us_in_second / 32;
+
+	/* TCC1 counts the timestamp's microseconds, its CCB compare is left to the application */
+	host_TCC1.CNT = host_timestamp_usecond;
+
+	if ((host_TCC1.INTCTRLB & TC_CCBINTLVL_gm) && host_compare_passed(previous_usecond, host_timestamp_usecond, host_TCC1.CCB))
+		TCC1_CCB_vect();
+
+	core_callback_t_before_exec();
+
+	if (host_tick_is_1ms)
+	{
+		if (new_second)
+			core_callback_t_new_second();
+
+		core_callback_t_1ms();
+	}
+	else
+	{
+		core_callback_t_500us();
+	}
+
+	core_callback_t_after_exec();
+
+	host_tick_is_1ms = !host_tick_is_1ms;
+}
+
+void host_core_run_ms(uint32_t ms)
+{
+	while (ms--)
+	{
+		host_core_tick_500us();
+		host_core_tick_500us();
+	}
+}
+
+bool host_write_register(uint8_t add, uint8_t type, void * content, uint16_t n_elements)
+{
+	return core_write_app_register(add, type, (uint8_t*)content, n_elements);
+}
+
+bool host_read_register(uint8_t add, uint8_t type)
+{
+	return core_read_app_register(add, type);
+}
+
+void core_func_send_event(uint8_t add, bool use_core_timestamp)
+{
+	host_event_t * event = &host_events[host_events_count++ % HOST_EVENT_LOG_SIZE];
+
+	if (host_uart.size)
+	{
+		uint8_t type = app_regs_type[add - 0x20];
+		host_uart_queue(HOST_HARP_MESSAGE_OVERHEAD + (type & MSK_TYPE_LEN) * app_regs_n_elements[add - 0x20]);
+	}
+
+	if (!host_events_capture)
+		return;
+
+	event->host_ns = host_events_clock ? host_events_clock() : 0;
+
+	event->add = add;
+	event->type = app_regs_type[add - 0x20];
+	event->length = (event->type & MSK_TYPE_LEN) * app_regs_n_elements[add - 0x20];
+
+	if (event->length > HOST_EVENT_MAX_PAYLOAD)
+		event->length = HOST_EVENT_MAX_PAYLOAD;
+
+	memcpy(event->payload, app_regs_pointer[add - 0x20], event->length);
+
+	event->second = use_core_timestamp ? host_timestamp_second : user_timestamp_second;
+	event->usecond = use_core_timestamp ? host_timestamp_usecond : user_timestamp_usecond;
+
+	if (host_events_sink)
+		host_events_sink(event);
+}
+
+void core_func_mark_user_timestamp(void)
+{
+	user_timestamp_second = host_timestamp_second;
+	user_timestamp_usecond = host_timestamp_usecond;
+}
+
+void core_func_update_user_timestamp(uint32_t seconds, uint16_t useconds)
+{
+	user_timestamp_second = seconds;
+	user_timestamp_usecond = useconds;
+}
+
+void core_func_read_user_timestamp(uint32_t *seconds, uint16_t *useconds)
+{
+	*seconds = user_timestamp_second;
+	*useconds = user_timestamp_usecond;
+}
+
+uint32_t core_func_read_R_TIMESTAMP_SECOND(void) { return host_timestamp_second; }
+uint16_t core_func_read_R_TIMESTAMP_MICRO(void) { return host_timestamp_usecond; }
+
+bool core_bool_is_visual_enabled(void) { return true; }
+bool core_bool_speed_mode_is_in_use(void) { return false; }
+bool core_bool_device_is_active(void) { return true; }
+bool core_bool_device_is_synchronized(void) { return false; }
+
+void core_func_catastrophic_error_detected(void)
+{
+	core_callback_catastrophic_error_detected();
+}
+
+/************************************************************************/
+/* CPU library                                                          */
+/************************************************************************/
+void io_pin2in(PORT_t* port, uint8_t pin, uint8_t pull, uint8_t sense)
+{
+	port->DIRCLR = (1 << pin);
+	*(&port->PIN0CTRL + pin) = pull | sense;
+	port->DIR &= ~(1 << pin);
+}
+
+void io_pin2out(PORT_t* port, uint8_t pin, uint8_t out, bool input_en)
+{
+	port->DIRSET = (1 << pin);
+	*(&port->PIN0CTRL + pin) = out | (input_en ? 0 : 0x07);
+	port->DIR |= (1 << pin);
+}
+
+void io_set_int(PORT_t* port, uint8_t int_level, uint8_t int_n, uint8_t mask, bool reset_mask)
+{
+	if (int_n == 0)
+	{
+		port->INT0MASK = reset_mask ? mask : (port->INT0MASK | mask);
+		port->INTCTRL = (port->INTCTRL & ~PORT_INT0LVL_gm) | int_level;
+	}
+	else
+	{
+		port->INT1MASK = reset_mask ? mask : (port->INT1MASK | mask);
+		port->INTCTRL = (port->INTCTRL & ~PORT_INT1LVL_gm) | (int_level << 2);
+	}
+}
+
+void timer_type0_enable(TC0_t* timer, uint8_t prescaler, uint16_t target_count, uint8_t int_level)
+{
+	timer->CTRLA = TC_CLKSEL_OFF_gc;
+	timer->CTRLFSET = TC_CMD_RESET_gc;
+	timer->PER = target_count - 1;
+	timer->INTCTRLA = int_level;
+	timer->CTRLA = prescaler;
+}
+
+void timer_type0_pwm(TC0_t* timer, uint8_t prescaler, uint16_t target_count, uint16_t duty_cycle_count, uint8_t int_level_ovf, uint8_t int_level_cca)
+{
+	timer->CTRLA = TC_CLKSEL_OFF_gc;
+	timer->CTRLFSET = TC_CMD_RESET_gc;
+	timer->CTRLB = TC0_CCAEN_bm | TC_WGMODE_SS_gc;
+	timer->PER = target_count - 1;
+	timer->CCA = duty_cycle_count;
+	timer->INTCTRLA = int_level_ovf;
+	timer->INTCTRLB = int_level_cca;
+	timer->CTRLA = prescaler;
+}
+
+void timer_type0_stop(TC0_t* timer)
+{
+	timer->CTRLA = TC_CLKSEL_OFF_gc;
+	timer->CTRLFSET = TC_CMD_RESET_gc;
+	timer->CTRLB = 0;
+	timer->INTCTRLA = 0;
+	timer->INTCTRLB = 0;
+	timer->CNT = 0;
+}
+
+void timer_type1_enable(TC1_t* timer, uint8_t prescaler, uint16_t target_count, uint8_t int_level)
+{
+	timer->CTRLA = TC_CLKSEL_OFF_gc;
+	timer->CTRLFSET = TC_CMD_RESET_gc;
+	timer->PER = target_count - 1;
+	timer->INTCTRLA = int_level;
+	timer->CTRLA = prescaler;
+}
+
+void timer_type1_stop(TC1_t* timer)
+{
+	timer->CTRLA = TC_CLKSEL_OFF_gc;
+	timer->CTRLFSET = TC_CMD_RESET_gc;
+	timer->INTCTRLA = 0;
+	timer->INTCTRLB = 0;
+	timer->CNT = 0;
+}
+
+bool calculate_timer_16bits(uint32_t f_cpu, float freq, uint8_t * timer_prescaler, uint16_t * timer_target_count)
+{
+	static const uint16_t divs[] = {1, 2, 4, 8, 64, 256, 1024};
+
+	for (uint8_t i = 0; i < sizeof(divs) / sizeof(divs[0]); i++)
+	{
+		float target = f_cpu / divs[i] / freq + 0.5;
+
+		if (target <= 65535)
+		{
+			*timer_prescaler = i + 1;
+			*timer_target_count = (uint16_t)target;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void adc_A_initialize_single_ended(uint8_t analog_reference)
+{
+	host_ADCA.REFCTRL = analog_reference;
+	host_ADCA.CTRLA = 0x01;
+}
+
+/************************************************************************/
+/* WS2812 driver                                                        */
+/************************************************************************/
+uint8_t host_rgbs[9];
+
+void initialize_rgb (void)
+{
+	RGB_PORT.DIR |= (1 << RGB_PIN);
+}
+
+void update_2rgbs (uint8_t * rgb_led0, uint8_t * rgb_led1)
+{
+	memcpy(host_rgbs, rgb_led0, 3);
+	memcpy(host_rgbs + 3, rgb_led1, 3);
+}
+
+void update_3rgbs (uint8_t * rgb_led0, uint8_t * rgb_led1, uint8_t * rgb_led2)
+{
+	memcpy(host_rgbs, rgb_led0, 3);
+	memcpy(host_rgbs + 3, rgb_led1, 3);
+	memcpy(host_rgbs + 6, rgb_led2, 3);
+}
@@ -0,0 +1,122 @@
+#ifndef _HWBP_CORE_HOST_H_
+#define _HWBP_CORE_HOST_H_
+#include <avr/io.h>
+
+/************************************************************************/
+/* Host replacement for the Harp core                                   */
+/*                                                                      */
+/* Implements the part of hwbp_core.h and cpu.h that the application    */
+/* links against, recording every core_func_send_event() call so the    */
+/* register handlers and ISR bodies can be driven on a workstation.     */
+/************************************************************************/
+#ifndef bool
+	#define bool uint8_t
+#endif
+#ifndef true
+	#define true 1
+#endif
+#ifndef false
+	#define false 0
+#endif
+
+/************************************************************************/
+/* Event log                                                            */
+/************************************************************************/
+#define HOST_EVENT_MAX_PAYLOAD	64
+#define HOST_EVENT_LOG_SIZE		4096
+
+typedef struct
+{
+	uint8_t add;
+	uint8_t type;
+	uint8_t length;
+	uint32_t second;
+	uint16_t usecond;
+	uint64_t host_ns;
+	uint8_t payload[HOST_EVENT_MAX_PAYLOAD];
+} host_event_t;
+
+/* Ring buffer holding the last HOST_EVENT_LOG_SIZE events */
+extern host_event_t host_events[HOST_EVENT_LOG_SIZE];
+/* Number of events sent since the last host_events_clear() */
+extern uint32_t host_events_count;
+/* When false, events are only counted (no payload copy) */
+extern bool host_events_capture;
+/* If set, used to stamp every event with the host time it was sent at */
+extern uint64_t (*host_events_clock)(void);
+/* If set, called with every captured event */
+extern void (*host_events_sink)(const host_event_t * event);
+
+void host_events_clear(void);
+host_event_t * host_events_last(void);
+
+/************************************************************************/
+/* Harp UART TX path                                                    */
+/*                                                                      */
+/* When enabled, every event is queued as a timestamped Harp message    */
+/* (12 bytes + payload) into a buffer of the given size that drains at  */
+/* the link rate. Messages that don't fit are dropped and counted.      */
+/* The core's hwbp_uart_head/tail follow the model, so the firmware's   */
+/* own TX buffer monitor sees the same occupancy. The size must not     */
+/* exceed TX_BUFFER_SIZE.                                               */
+/************************************************************************/
+#define HOST_HARP_MESSAGE_OVERHEAD	12
+
+typedef struct
+{
+	uint16_t size;					// Buffer size in bytes, 0 disables the model
+	uint32_t bytes_per_second;		// Drain rate
+	double level;					// Bytes waiting to be transmitted
+	uint16_t high_water;
+	uint32_t queued, dropped;
+	uint32_t bytes;					// Offered, including the dropped messages
+	uint32_t late;					// Queued behind more than late_us of data
+	double late_us;
+	double max_delay_us;
+} host_uart_t;
+
+extern host_uart_t host_uart;
+
+void host_uart_reset(uint16_t size, uint32_t bytes_per_second, double late_us);
+void host_uart_drain(double us);
+
+/************************************************************************/
+/* Core emulation                                                       */
+/************************************************************************/
+/* Identity the application passed to core_func_start_core() */
+typedef struct
+{
+	uint16_t who_am_i;
+	uint8_t hw_h, hw_l;
+	uint8_t fw_h, fw_l;
+	uint8_t assembly;
+	char name[25];
+} host_device_t;
+
+extern host_device_t host_device;
+
+/* Harp timestamp, with the microseconds in 32 us units as on the device */
+extern uint32_t host_timestamp_second;
+extern uint16_t host_timestamp_usecond;
+
+/* If set, called after the peripherals reset to drive the input levels */
+/* the application sees while it initializes */
+extern void (*host_boot_inputs)(void);
+
+/* Resets all peripherals and runs the core boot sequence */
+void host_core_boot(void);
+/* Runs one 500 us tick of the core timer (t_1ms and t_500us alternate) */
+void host_core_tick_500us(void);
+/* Applies the OUTSET, OUTCLR and OUTTGL writes to the ports' OUT */
+void host_ports_latch(void);
+/* Advances the core by the given number of milliseconds */
+void host_core_run_ms(uint32_t ms);
+
+/* Writes/reads an application register the way the core does it */
+bool host_write_register(uint8_t add, uint8_t type, void * content, uint16_t n_elements);
+bool host_read_register(uint8_t add, uint8_t type);
+
+/* Drives the level seen on a digital input pin */
+void host_set_pin(PORT_t * port, uint8_t pin, bool level);
+
+#endif /* _HWBP_CORE_HOST_H_ */
@@ -0,0 +1,22 @@
+#ifndef _HOST_AVR_INTERRUPT_H_
+#define _HOST_AVR_INTERRUPT_H_
+
+/************************************************************************/
+/* Host replacement for <avr/interrupt.h>                               */
+/*                                                                      */
+/* An ISR becomes a plain function named after its vector so the bench  */
+/* and the emulator can call it directly, e.g. PORTD_INT0_vect().       */
+/************************************************************************/
+#include <avr/io.h>
+
+#define ISR_NAKED
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+
+#define ISR(vector, ...) void vector(void); void vector(void)
+#define reti() return
+
+#define sei()
+#define cli()
+
+#endif /* _HOST_AVR_INTERRUPT_H_ */
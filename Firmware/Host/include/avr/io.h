@@ -0,0 +1,642 @@
+#ifndef _HOST_AVR_IO_H_
+#define _HOST_AVR_IO_H_
+
+/************************************************************************/
+/* Host replacement for <avr/io.h>                                      */
+/*                                                                      */
+/* Only the ATxmega128A1U peripherals used by the application are       */
+/* modelled. Every peripheral is a plain, memory-backed structure so    */
+/* the application code can be compiled and driven on a workstation.    */
+/* Writing to a strobe register (OUTSET, CTRLFSET, ...) only stores the */
+/* value; use host_ports_latch() to fold the strobes into OUT.          */
+/************************************************************************/
+#include <stdint.h>
+
+typedef volatile uint8_t register8_t;
+typedef volatile uint16_t register16_t;
+typedef volatile uint32_t register32_t;
+
+#define _WORDREGISTER(regname) register16_t regname
+#define _DWORDREGISTER(regname) register32_t regname
+
+/************************************************************************/
+/* I/O ports                                                            */
+/************************************************************************/
+typedef struct PORT_struct
+{
+	register8_t DIR;
+	register8_t DIRSET;
+	register8_t DIRCLR;
+	register8_t DIRTGL;
+	register8_t OUT;
+	register8_t OUTSET;
+	register8_t OUTCLR;
+	register8_t OUTTGL;
+	register8_t IN;
+	register8_t INTCTRL;
+	register8_t INT0MASK;
+	register8_t INT1MASK;
+	register8_t INTFLAGS;
+	register8_t reserved_0x0D;
+	register8_t REMAP;
+	register8_t reserved_0x0F;
+	register8_t PIN0CTRL;
+	register8_t PIN1CTRL;
+	register8_t PIN2CTRL;
+	register8_t PIN3CTRL;
+	register8_t PIN4CTRL;
+	register8_t PIN5CTRL;
+	register8_t PIN6CTRL;
+	register8_t PIN7CTRL;
+} PORT_t;
+
+#define PORT_INT0LVL_gm  0x03
+#define PORT_INT0LVL_gp  0
+#define PORT_INT1LVL_gm  0x0C
+#define PORT_INT1LVL_gp  2
+#define PORT_INT0IF_bm  0x01
+#define PORT_INT1IF_bm  0x02
+
+/************************************************************************/
+/* 16-bit Timer/Counter type 0 and type 1                               */
+/************************************************************************/
+typedef struct TC0_struct
+{
+	register8_t CTRLA;
+	register8_t CTRLB;
+	register8_t CTRLC;
+	register8_t CTRLD;
+	register8_t CTRLE;
+	register8_t reserved_0x05;
+	register8_t INTCTRLA;
+	register8_t INTCTRLB;
+	register8_t CTRLFCLR;
+	register8_t CTRLFSET;
+	register8_t CTRLGCLR;
+	register8_t CTRLGSET;
+	register8_t INTFLAGS;
+	register8_t reserved_0x0D[2];
+	register8_t TEMP;
+	register8_t reserved_0x10[16];
+	_WORDREGISTER(CNT);
+	register8_t reserved_0x22[4];
+	_WORDREGISTER(PER);
+	_WORDREGISTER(CCA);
+	_WORDREGISTER(CCB);
+	_WORDREGISTER(CCC);
+	_WORDREGISTER(CCD);
+	register8_t reserved_0x30[6];
+	_WORDREGISTER(PERBUF);
+	_WORDREGISTER(CCABUF);
+	_WORDREGISTER(CCBBUF);
+	_WORDREGISTER(CCCBUF);
+	_WORDREGISTER(CCDBUF);
+} TC0_t;
+
+typedef struct TC1_struct
+{
+	register8_t CTRLA;
+	register8_t CTRLB;
+	register8_t CTRLC;
+	register8_t CTRLD;
+	register8_t CTRLE;
+	register8_t reserved_0x05;
+	register8_t INTCTRLA;
+	register8_t INTCTRLB;
+	register8_t CTRLFCLR;
+	register8_t CTRLFSET;
+	register8_t CTRLGCLR;
+	register8_t CTRLGSET;
+	register8_t INTFLAGS;
+	register8_t reserved_0x0D[2];
+	register8_t TEMP;
+	register8_t reserved_0x10[16];
+	_WORDREGISTER(CNT);
+	register8_t reserved_0x22[4];
+	_WORDREGISTER(PER);
+	_WORDREGISTER(CCA);
+	_WORDREGISTER(CCB);
+	register8_t reserved_0x2C[10];
+	_WORDREGISTER(PERBUF);
+	_WORDREGISTER(CCABUF);
+	_WORDREGISTER(CCBBUF);
+} TC1_t;
+
+#define TC_CLKSEL_OFF_gc  (0x00<<0)
+#define TC_CLKSEL_DIV1_gc  (0x01<<0)
+#define TC_CLKSEL_DIV2_gc  (0x02<<0)
+#define TC_CLKSEL_DIV4_gc  (0x03<<0)
+#define TC_CLKSEL_DIV8_gc  (0x04<<0)
+#define TC_CLKSEL_DIV64_gc  (0x05<<0)
+#define TC_CLKSEL_DIV256_gc  (0x06<<0)
+#define TC_CLKSEL_DIV1024_gc  (0x07<<0)
+#define TC_CLKSEL_EVCH0_gc  (0x08<<0)
+#define TC_CLKSEL_EVCH1_gc  (0x09<<0)
+#define TC_CLKSEL_EVCH2_gc  (0x0A<<0)
+#define TC_CLKSEL_EVCH3_gc  (0x0B<<0)
+#define TC_CLKSEL_EVCH4_gc  (0x0C<<0)
+#define TC_CLKSEL_EVCH5_gc  (0x0D<<0)
+#define TC_CLKSEL_EVCH6_gc  (0x0E<<0)
+#define TC_CLKSEL_EVCH7_gc  (0x0F<<0)
+
+#define TC0_CCAEN_bm  0x10
+#define TC0_CCBEN_bm  0x20
+#define TC0_CCCEN_bm  0x40
+#define TC0_CCDEN_bm  0x80
+#define TC1_CCAEN_bm  0x10
+#define TC1_CCBEN_bm  0x20
+
+#define TC_WGMODE_NORMAL_gc  (0x00<<0)
+#define TC_WGMODE_FRQ_gc  (0x01<<0)
+#define TC_WGMODE_SS_gc  (0x03<<0)
+#define TC_WGMODE_DS_T_gc  (0x05<<0)
+#define TC_WGMODE_DS_TB_gc  (0x06<<0)
+#define TC_WGMODE_DS_B_gc  (0x07<<0)
+
+#define TC0_CMPA_bm  0x01
+#define TC0_CMPB_bm  0x02
+#define TC0_CMPC_bm  0x04
+#define TC0_CMPD_bm  0x08
+#define TC1_CMPA_bm  0x01
+#define TC1_CMPB_bm  0x02
+
+#define TC_EVACT_OFF_gc  (0x00<<5)
+#define TC_EVACT_CAPT_gc  (0x01<<5)
+#define TC_EVACT_UPDOWN_gc  (0x02<<5)
+#define TC_EVACT_QDEC_gc  (0x03<<5)
+#define TC_EVACT_RESTART_gc  (0x04<<5)
+#define TC_EVACT_FRQ_gc  (0x05<<5)
+#define TC_EVACT_PW_gc  (0x06<<5)
+#define TC0_EVDLY_bm  0x10
+#define TC1_EVDLY_bm  0x10
+
+#define TC_EVSEL_OFF_gc  (0x00<<0)
+#define TC_EVSEL_CH0_gc  (0x08<<0)
+#define TC_EVSEL_CH1_gc  (0x09<<0)
+#define TC_EVSEL_CH2_gc  (0x0A<<0)
+#define TC_EVSEL_CH3_gc  (0x0B<<0)
+#define TC_EVSEL_CH4_gc  (0x0C<<0)
+#define TC_EVSEL_CH5_gc  (0x0D<<0)
+#define TC_EVSEL_CH6_gc  (0x0E<<0)
+#define TC_EVSEL_CH7_gc  (0x0F<<0)
+
+#define TC_OVFINTLVL_OFF_gc  (0x00<<0)
+#define TC_OVFINTLVL_LO_gc  (0x01<<0)
+#define TC_OVFINTLVL_MED_gc  (0x02<<0)
+#define TC_OVFINTLVL_HI_gc  (0x03<<0)
+#define TC_OVFINTLVL_gm  0x03
+
+#define TC_CCAINTLVL_OFF_gc  (0x00<<0)
+#define TC_CCAINTLVL_LO_gc  (0x01<<0)
+#define TC_CCAINTLVL_MED_gc  (0x02<<0)
+#define TC_CCAINTLVL_HI_gc  (0x03<<0)
+#define TC_CCAINTLVL_gm  0x03
+#define TC_CCBINTLVL_OFF_gc  (0x00<<2)
+#define TC_CCBINTLVL_LO_gc  (0x01<<2)
+#define TC_CCBINTLVL_MED_gc  (0x02<<2)
+#define TC_CCBINTLVL_HI_gc  (0x03<<2)
+#define TC_CCBINTLVL_gm  0x0C
+#define TC_CCCINTLVL_OFF_gc  (0x00<<4)
+#define TC_CCCINTLVL_LO_gc  (0x01<<4)
+#define TC_CCCINTLVL_gm  0x30
+#define TC_CCDINTLVL_OFF_gc  (0x00<<6)
+#define TC_CCDINTLVL_LO_gc  (0x01<<6)
+#define TC_CCDINTLVL_gm  0xC0
+
+#define TC_CMD_NONE_gc  (0x00<<2)
+#define TC_CMD_UPDATE_gc  (0x01<<2)
+#define TC_CMD_RESTART_gc  (0x02<<2)
+#define TC_CMD_RESET_gc  (0x03<<2)
+#define TC0_LUPD_bm  0x02
+#define TC1_LUPD_bm  0x02
+#define TC0_DIR_bm  0x01
+
+#define TC0_OVFIF_bm  0x01
+#define TC0_ERRIF_bm  0x02
+#define TC0_CCAIF_bm  0x10
+#define TC0_CCBIF_bm  0x20
+#define TC0_CCCIF_bm  0x40
+#define TC0_CCDIF_bm  0x80
+#define TC1_OVFIF_bm  0x01
+#define TC1_ERRIF_bm  0x02
+#define TC1_CCAIF_bm  0x10
+#define TC1_CCBIF_bm  0x20
+
+/************************************************************************/
+/* ADC                                                                  */
+/************************************************************************/
+typedef struct ADC_CH_struct
+{
+	register8_t CTRL;
+	register8_t MUXCTRL;
+	register8_t INTCTRL;
+	register8_t INTFLAGS;
+	_WORDREGISTER(RES);
+	register8_t SCAN;
+	register8_t reserved_0x07;
+} ADC_CH_t;
+
+typedef struct ADC_struct
+{
+	register8_t CTRLA;
+	register8_t CTRLB;
+	register8_t REFCTRL;
+	register8_t EVCTRL;
+	register8_t PRESCALER;
+	register8_t reserved_0x05;
+	register8_t INTFLAGS;
+	register8_t TEMP;
+	register8_t reserved_0x08[4];
+	_WORDREGISTER(CAL);
+	register8_t reserved_0x0E[2];
+	_WORDREGISTER(CH0RES);
+	_WORDREGISTER(CH1RES);
+	_WORDREGISTER(CH2RES);
+	_WORDREGISTER(CH3RES);
+	_WORDREGISTER(CMP);
+	register8_t reserved_0x1A[6];
+	ADC_CH_t CH0;
+	ADC_CH_t CH1;
+	ADC_CH_t CH2;
+	ADC_CH_t CH3;
+} ADC_t;
+
+#define ADC_CH_START_bm  0x80
+#define ADC_CH_CHIF_bm  0x01
+#define ADC_CH_INTLVL_OFF_gc  (0x00<<0)
+#define ADC_CH_INTLVL_LO_gc  (0x01<<0)
+#define ADC_CH_INTLVL_MED_gc  (0x02<<0)
+#define ADC_CH_INTLVL_HI_gc  (0x03<<0)
+#define ADC_REFSEL_INT1V_gc  (0x00<<4)
+#define ADC_REFSEL_INTVCC_gc  (0x01<<4)
+#define ADC_REFSEL_AREFA_gc  (0x02<<4)
+#define ADC_REFSEL_AREFB_gc  (0x03<<4)
+#define ADC_REFSEL_INTVCC2_gc  (0x04<<4)
+#define ADC_BANDGAP_bm  0x02
+#define ADC_RESOLUTION_12BIT_gc  (0x00<<1)
+#define ADC_RESOLUTION_8BIT_gc  (0x02<<1)
+#define ADC_PRESCALER_DIV4_gc  (0x00<<0)
+#define ADC_PRESCALER_DIV8_gc  (0x01<<0)
+#define ADC_PRESCALER_DIV16_gc  (0x02<<0)
+#define ADC_PRESCALER_DIV32_gc  (0x03<<0)
+#define ADC_PRESCALER_DIV64_gc  (0x04<<0)
+#define ADC_PRESCALER_DIV128_gc  (0x05<<0)
+#define ADC_PRESCALER_DIV256_gc  (0x06<<0)
+#define ADC_PRESCALER_DIV512_gc  (0x07<<0)
+
+/************************************************************************/
+/* DAC                                                                  */
+/************************************************************************/
+typedef struct DAC_struct
+{
+	register8_t CTRLA;
+	register8_t CTRLB;
+	register8_t CTRLC;
+	register8_t EVCTRL;
+	register8_t TIMCTRL;
+	register8_t STATUS;
+	register8_t reserved_0x06[2];
+	register8_t CH0GAINCAL;
+	register8_t CH0OFFSETCAL;
+	register8_t CH1GAINCAL;
+	register8_t CH1OFFSETCAL;
+	register8_t reserved_0x0C[12];
+	_WORDREGISTER(CH0DATA);
+	_WORDREGISTER(CH1DATA);
+} DAC_t;
+
+#define DAC_ENABLE_bm  0x01
+#define DAC_CH0EN_bm  0x04
+#define DAC_CH1EN_bm  0x08
+#define DAC_CHSEL_SINGLE_gc  (0x00<<5)
+#define DAC_CHSEL_DUAL_gc  (0x02<<5)
+#define DAC_CH0TRIG_bm  0x01
+#define DAC_CH1TRIG_bm  0x02
+#define DAC_REFSEL_INT1V_gc  (0x00<<3)
+#define DAC_REFSEL_AVCC_gc  (0x01<<3)
+#define DAC_EVSEL_0_gc  (0x00<<0)
+#define DAC_CH0DRE_bm  0x01
+#define DAC_CH1DRE_bm  0x02
+
+/************************************************************************/
+/* USART                                                                */
+/************************************************************************/
+typedef struct USART_struct
+{
+	register8_t DATA;
+	register8_t STATUS;
+	register8_t reserved_0x02;
+	register8_t CTRLA;
+	register8_t CTRLB;
+	register8_t CTRLC;
+	register8_t BAUDCTRLA;
+	register8_t BAUDCTRLB;
+} USART_t;
+
+#define USART_DREIF_bm  0x20
+#define USART_TXCIF_bm  0x40
+#define USART_RXCIF_bm  0x80
+#define USART_DREINTLVL_OFF_gc  (0x00<<0)
+#define USART_DREINTLVL_LO_gc  (0x01<<0)
+#define USART_DREINTLVL_MED_gc  (0x02<<0)
+#define USART_DREINTLVL_HI_gc  (0x03<<0)
+#define USART_DREINTLVL_gm  0x03
+#define USART_CLK2X_bm  0x04
+#define USART_TXEN_bm  0x08
+#define USART_RXEN_bm  0x10
+#define USART_CMODE_ASYNCHRONOUS_gc  (0x00<<6)
+#define USART_PMODE_DISABLED_gc  (0x00<<4)
+#define USART_CHSIZE_8BIT_gc  (0x03<<0)
+
+/************************************************************************/
+/* Event System                                                         */
+/************************************************************************/
+typedef struct EVSYS_struct
+{
+	register8_t CH0MUX;
+	register8_t CH1MUX;
+	register8_t CH2MUX;
+	register8_t CH3MUX;
+	register8_t CH4MUX;
+	register8_t CH5MUX;
+	register8_t CH6MUX;
+	register8_t CH7MUX;
+	register8_t CH0CTRL;
+	register8_t CH1CTRL;
+	register8_t CH2CTRL;
+	register8_t CH3CTRL;
+	register8_t CH4CTRL;
+	register8_t CH5CTRL;
+	register8_t CH6CTRL;
+	register8_t CH7CTRL;
+	register8_t STROBE;
+	register8_t DATA;
+} EVSYS_t;
+
+#define EVSYS_CHMUX_OFF_gc  (0x00<<0)
+#define EVSYS_CHMUX_PORTC_PIN0_gc  (0x60<<0)
+#define EVSYS_CHMUX_PORTD_PIN0_gc  (0x68<<0)
+#define EVSYS_CHMUX_PORTD_PIN4_gc  (0x6C<<0)
+#define EVSYS_CHMUX_PORTD_PIN5_gc  (0x6D<<0)
+#define EVSYS_CHMUX_PORTE_PIN0_gc  (0x70<<0)
+#define EVSYS_CHMUX_PORTE_PIN4_gc  (0x74<<0)
+#define EVSYS_CHMUX_PORTE_PIN5_gc  (0x75<<0)
+#define EVSYS_CHMUX_PORTF_PIN0_gc  (0x78<<0)
+#define EVSYS_CHMUX_PORTF_PIN4_gc  (0x7C<<0)
+#define EVSYS_CHMUX_PORTF_PIN5_gc  (0x7D<<0)
+#define EVSYS_CHMUX_PORTH_PIN0_gc  (0x80<<0)
+#define EVSYS_CHMUX_PRESCALER_1_gc  (0x80<<0)
+#define EVSYS_CHMUX_PRESCALER_2_gc  (0x81<<0)
+#define EVSYS_CHMUX_PRESCALER_4_gc  (0x82<<0)
+#define EVSYS_CHMUX_PRESCALER_8_gc  (0x83<<0)
+#define EVSYS_CHMUX_PRESCALER_64_gc  (0x86<<0)
+#define EVSYS_CHMUX_PRESCALER_256_gc  (0x88<<0)
+#define EVSYS_CHMUX_PRESCALER_1024_gc  (0x8A<<0)
+#define EVSYS_CHMUX_PRESCALER_32768_gc  (0x8F<<0)
+#define EVSYS_CHMUX_TCC0_OVF_gc  (0xC0<<0)
+#define EVSYS_CHMUX_TCC1_OVF_gc  (0xC8<<0)
+#define EVSYS_CHMUX_TCD0_OVF_gc  (0xD0<<0)
+#define EVSYS_CHMUX_TCD1_OVF_gc  (0xD8<<0)
+#define EVSYS_CHMUX_TCE0_OVF_gc  (0xE0<<0)
+#define EVSYS_CHMUX_TCE1_OVF_gc  (0xE8<<0)
+#define EVSYS_CHMUX_TCF0_OVF_gc  (0xF0<<0)
+#define EVSYS_CHMUX_TCF1_OVF_gc  (0xF8<<0)
+#define EVSYS_QDEN_bm  0x10
+#define EVSYS_DIGFILT_1SAMPLE_gc  (0x00<<0)
+#define EVSYS_DIGFILT_2SAMPLES_gc  (0x01<<0)
+#define EVSYS_DIGFILT_8SAMPLES_gc  (0x07<<0)
+
+/************************************************************************/
+/* DMA controller                                                       */
+/************************************************************************/
+typedef struct DMA_CH_struct
+{
+	register8_t CTRLA;
+	register8_t CTRLB;
+	register8_t ADDRCTRL;
+	register8_t TRIGSRC;
+	_WORDREGISTER(TRFCNT);
+	register8_t REPCNT;
+	register8_t reserved_0x07;
+	register8_t SRCADDR0;
+	register8_t SRCADDR1;
+	register8_t SRCADDR2;
+	register8_t reserved_0x0B;
+	register8_t DESTADDR0;
+	register8_t DESTADDR1;
+	register8_t DESTADDR2;
+	register8_t reserved_0x0F;
+} DMA_CH_t;
+
+typedef struct DMA_struct
+{
+	register8_t CTRL;
+	register8_t INTFLAGS;
+	register8_t STATUS;
+	register8_t reserved_0x03;
+	_WORDREGISTER(TEMP);
+	register8_t reserved_0x06[10];
+	DMA_CH_t CH0;
+	DMA_CH_t CH1;
+	DMA_CH_t CH2;
+	DMA_CH_t CH3;
+} DMA_t;
+
+#define DMA_ENABLE_bm  0x80
+#define DMA_CH_ENABLE_bm  0x80
+#define DMA_CH_REPEAT_bm  0x20
+#define DMA_CH_SINGLE_bm  0x04
+#define DMA_CH_BURSTLEN_1BYTE_gc  (0x00<<0)
+#define DMA_CH_BURSTLEN_2BYTE_gc  (0x01<<0)
+#define DMA_CH_TRNINTLVL_OFF_gc  (0x00<<0)
+#define DMA_CH_TRNINTLVL_LO_gc  (0x01<<0)
+#define DMA_CH_TRNIF_bm  0x10
+#define DMA_CH_ERRIF_bm  0x20
+#define DMA_CH_SRCRELOAD_BLOCK_gc  (0x02<<6)
+#define DMA_CH_SRCDIR_INC_gc  (0x01<<4)
+#define DMA_CH_DESTRELOAD_BURST_gc  (0x02<<2)
+#define DMA_CH_DESTDIR_INC_gc  (0x01<<0)
+#define DMA_CH_TRIGSRC_EVSYS_CH0_gc  (0x01<<0)
+#define DMA_CH_TRIGSRC_EVSYS_CH1_gc  (0x02<<0)
+#define DMA_CH_TRIGSRC_EVSYS_CH2_gc  (0x03<<0)
+#define DMA_CH_TRIGSRC_DACB_CH0_gc  (0x25<<0)
+#define DMA_CH_TRIGSRC_DACB_CH1_gc  (0x26<<0)
+
+/************************************************************************/
+/* Programmable Multilevel Interrupt Controller                         */
+/************************************************************************/
+typedef struct PMIC_struct
+{
+	register8_t STATUS;
+	register8_t INTPRI;
+	register8_t CTRL;
+} PMIC_t;
+
+#define PMIC_LOLVLEN_bm  0x01
+#define PMIC_MEDLVLEN_bm  0x02
+#define PMIC_HILVLEN_bm  0x04
+#define PMIC_RREN_bm  0x80
+#define PMIC_LOLVLEX_bm  0x01
+#define PMIC_MEDLVLEX_bm  0x02
+#define PMIC_HILVLEX_bm  0x04
+
+/************************************************************************/
+/* Peripheral instances                                                 */
+/************************************************************************/
+extern PORT_t host_PORTA, host_PORTB, host_PORTC, host_PORTD, host_PORTE, host_PORTF;
+extern PORT_t host_PORTH, host_PORTJ, host_PORTK, host_PORTQ, host_PORTR;
+extern TC0_t host_TCC0, host_TCD0, host_TCE0, host_TCF0;
+extern TC1_t host_TCC1, host_TCD1, host_TCE1, host_TCF1;
+extern ADC_t host_ADCA, host_ADCB;
+extern DAC_t host_DACA, host_DACB;
+extern USART_t host_USARTC0, host_USARTC1, host_USARTD0, host_USARTD1;
+extern USART_t host_USARTE0, host_USARTE1, host_USARTF0, host_USARTF1;
+extern EVSYS_t host_EVSYS;
+extern DMA_t host_DMA;
+extern PMIC_t host_PMIC;
+extern register8_t host_SREG;
+
+#define PORTA host_PORTA
+#define PORTB host_PORTB
+#define PORTC host_PORTC
+#define PORTD host_PORTD
+#define PORTE host_PORTE
+#define PORTF host_PORTF
+#define PORTH host_PORTH
+#define PORTJ host_PORTJ
+#define PORTK host_PORTK
+#define PORTQ host_PORTQ
+#define PORTR host_PORTR
+
+#define TCC0 host_TCC0
+#define TCD0 host_TCD0
+#define TCE0 host_TCE0
+#define TCF0 host_TCF0
+#define TCC1 host_TCC1
+#define TCD1 host_TCD1
+#define TCE1 host_TCE1
+#define TCF1 host_TCF1
+
+#define ADCA host_ADCA
+#define ADCB host_ADCB
+#define DACA host_DACA
+#define DACB host_DACB
+
+#define USARTC0 host_USARTC0
+#define USARTC1 host_USARTC1
+#define USARTD0 host_USARTD0
+#define USARTD1 host_USARTD1
+#define USARTE0 host_USARTE0
+#define USARTE1 host_USARTE1
+#define USARTF0 host_USARTF0
+#define USARTF1 host_USARTF1
+
+#define EVSYS host_EVSYS
+#define DMA host_DMA
+#define PMIC host_PMIC
+#define SREG host_SREG
+
+/* Flat register names used by the application */
+#define PORTB_OUTSET PORTB.OUTSET
+#define PORTB_OUTCLR PORTB.OUTCLR
+#define PORTC_OUTSET PORTC.OUTSET
+#define PORTC_OUTCLR PORTC.OUTCLR
+#define PORTD_INTCTRL PORTD.INTCTRL
+#define PORTD_INTFLAGS PORTD.INTFLAGS
+#define PORTE_INTCTRL PORTE.INTCTRL
+#define PORTE_INTFLAGS PORTE.INTFLAGS
+#define PORTF_INTCTRL PORTF.INTCTRL
+#define PORTF_INTFLAGS PORTF.INTFLAGS
+#define PORTH_INTCTRL PORTH.INTCTRL
+#define PORTH_INTFLAGS PORTH.INTFLAGS
+
+#define TCC0_CTRLA TCC0.CTRLA
+#define TCC0_CTRLB TCC0.CTRLB
+#define TCC0_CNT TCC0.CNT
+#define TCC0_PER TCC0.PER
+#define TCC0_CCA TCC0.CCA
+#define TCD0_CTRLA TCD0.CTRLA
+#define TCD0_CTRLB TCD0.CTRLB
+#define TCD0_CNT TCD0.CNT
+#define TCD0_PER TCD0.PER
+#define TCD0_CCA TCD0.CCA
+#define TCE0_CTRLA TCE0.CTRLA
+#define TCE0_CTRLB TCE0.CTRLB
+#define TCE0_CNT TCE0.CNT
+#define TCE0_PER TCE0.PER
+#define TCE0_CCA TCE0.CCA
+#define TCF0_CTRLA TCF0.CTRLA
+#define TCF0_CTRLB TCF0.CTRLB
+#define TCF0_CNT TCF0.CNT
+#define TCF0_PER TCF0.PER
+#define TCF0_CCA TCF0.CCA
+#define TCC1_CNT TCC1.CNT
+#define TCC1_CCB TCC1.CCB
+#define TCC1_INTCTRLB TCC1.INTCTRLB
+#define TCC1_INTFLAGS TCC1.INTFLAGS
+#define TCD1_CTRLA TCD1.CTRLA
+#define TCD1_CTRLD TCD1.CTRLD
+#define TCD1_CTRLFSET TCD1.CTRLFSET
+#define TCD1_CNT TCD1.CNT
+#define TCD1_PER TCD1.PER
+#define TCD1_INTCTRLA TCD1.INTCTRLA
+#define TCD1_INTFLAGS TCD1.INTFLAGS
+#define TCE1_CTRLA TCE1.CTRLA
+#define TCE1_CTRLB TCE1.CTRLB
+#define TCE1_CTRLD TCE1.CTRLD
+#define TCE1_CTRLFSET TCE1.CTRLFSET
+#define TCE1_CNT TCE1.CNT
+#define TCE1_PER TCE1.PER
+#define TCE1_CCA TCE1.CCA
+#define TCE1_CCB TCE1.CCB
+#define TCE1_INTFLAGS TCE1.INTFLAGS
+#define TCF1_CTRLA TCF1.CTRLA
+#define TCF1_CTRLB TCF1.CTRLB
+#define TCF1_CTRLD TCF1.CTRLD
+#define TCF1_CTRLFSET TCF1.CTRLFSET
+#define TCF1_CNT TCF1.CNT
+#define TCF1_PER TCF1.PER
+#define TCF1_CCA TCF1.CCA
+#define TCF1_CCB TCF1.CCB
+#define TCF1_INTCTRLA TCF1.INTCTRLA
+#define TCF1_INTCTRLB TCF1.INTCTRLB
+#define TCF1_INTFLAGS TCF1.INTFLAGS
+
+#define ADCA_CH0_CTRL ADCA.CH0.CTRL
+#define ADCA_CH0_MUXCTRL ADCA.CH0.MUXCTRL
+#define ADCA_CH0_INTCTRL ADCA.CH0.INTCTRL
+#define ADCA_CH0_INTFLAGS ADCA.CH0.INTFLAGS
+#define ADCA_CH0_RES ADCA.CH0.RES
+
+#define DACB_CH0DATA DACB.CH0DATA
+#define DACB_CH1DATA DACB.CH1DATA
+
+#define USARTF0_CTRLA USARTF0.CTRLA
+#define USARTF1_DATA USARTF1.DATA
+#define USARTF1_CTRLA USARTF1.CTRLA
+
+#define EVSYS_CH0MUX EVSYS.CH0MUX
+#define EVSYS_CH1MUX EVSYS.CH1MUX
+#define EVSYS_CH2MUX EVSYS.CH2MUX
+#define EVSYS_CH3MUX EVSYS.CH3MUX
+#define EVSYS_CH4MUX EVSYS.CH4MUX
+#define EVSYS_CH5MUX EVSYS.CH5MUX
+#define EVSYS_CH6MUX EVSYS.CH6MUX
+#define EVSYS_CH7MUX EVSYS.CH7MUX
+#define EVSYS_CH0CTRL EVSYS.CH0CTRL
+#define EVSYS_CH1CTRL EVSYS.CH1CTRL
+#define EVSYS_CH2CTRL EVSYS.CH2CTRL
+#define EVSYS_CH3CTRL EVSYS.CH3CTRL
+#define EVSYS_STROBE EVSYS.STROBE
+
+#define DMA_CTRL DMA.CTRL
+
+#define PMIC_CTRL PMIC.CTRL
+
+/************************************************************************/
+/* Host helpers                                                         */
+/************************************************************************/
+/* Applies OUTSET/OUTCLR/OUTTGL (and DIR strobes) to OUT on every port */
+void host_ports_latch(void);
+
+#endif /* _HOST_AVR_IO_H_ */
@@ -0,0 +1,15 @@
+#ifndef _HOST_UTIL_DELAY_H_
+#define _HOST_UTIL_DELAY_H_
+
+/************************************************************************/
+/* Host replacement for <util/delay.h>                                  */
+/*                                                                      */
+/* Busy waits are accumulated instead of spent, so the bench can report */
+/* how long a handler would have blocked the CPU on the device.         */
+/************************************************************************/
+extern double host_delay_us_total;
+
+#define _delay_us(us) (host_delay_us_total += (double)(us))
+#define _delay_ms(ms) (host_delay_us_total += (double)(ms) * 1000.0)
+
+#endif /* _HOST_UTIL_DELAY_H_ */
@@ -0,0 +1,269 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hwbp_core.h"
+#include "hwbp_core_types.h"
+#include "hwbp_core_com.h"
+#include "app_ios_and_regs.h"
+#include "app_funcs.h"
+
+#include "hwbp_core_host.h"
+
+/************************************************************************/
+/* Sustained event-throughput stress test of the Harp TX path           */
+/*                                                                      */
+/* Runs the production stream mix (every REG_EVNT_ENABLE bit, both      */
+/* cameras at 600 Hz, ADC at 1 kHz and all pokes and DI3 toggling at    */
+/* 100 Hz) against a model of the UART TX buffer. The mix is then       */
+/* scaled up until messages are dropped or queued for longer than the   */
+/* late threshold, which gives the sustainable event rate.              */
+/************************************************************************/
+extern AppRegs app_regs;
+extern bool first_adc_channel;
+
+void PORTD_INT0_vect(void);
+void PORTE_INT0_vect(void);
+void PORTF_INT0_vect(void);
+void PORTH_INT0_vect(void);
+void TCF0_OVF_vect(void);
+void TCE0_OVF_vect(void);
+void ADCA_CH0_vect(void);
+
+#define STEP_US 5
+
+typedef struct
+{
+	double period_us;
+	double next_us;
+} source_t;
+
+typedef struct
+{
+	double scale;
+	uint32_t seconds;
+	uint32_t events;
+	double bytes_per_second;
+	host_uart_t uart;
+} stress_result_t;
+
+/* Poke inputs honour the input filter: an edge that arrives while the */
+/* port interrupt is disabled stays pending until it is enabled again */
+typedef struct
+{
+	PORT_t * port;
+	uint8_t pin;
+	void (*isr)(void);
+	bool pending;
+} poke_t;
+
+static void poke_edge(poke_t * poke)
+{
+	poke->port->IN ^= (1 << poke->pin);
+	poke->pending = true;
+}
+
+static void poke_service(poke_t * poke)
+{
+	if (poke->pending && (poke->port->INTCTRL & PORT_INT0LVL_gm))
+	{
+		poke->pending = false;
+		poke->isr();
+	}
+}
+
+static bool source_due(source_t * source, uint32_t now_us)
+{
+	if (now_us < source->next_us)
+		return false;
+
+	source->next_us += source->period_us;
+	return true;
+}
+
+static void stress_run(double scale, uint32_t seconds, uint16_t buffer_size, uint32_t baud, double late_us, stress_result_t * result)
+{
+	uint8_t reg8;
+	uint16_t reg16;
+
+	poke_t pokes[] = {
+		{&PORTD, 4, PORTD_INT0_vect, false},
+		{&PORTE, 4, PORTE_INT0_vect, false},
+		{&PORTF, 4, PORTF_INT0_vect, false},
+		{&PORTH, 0, PORTH_INT0_vect, false},
+	};
+
+	/* Offsets spread the sources so they don't all fire on the same step */
+	source_t cam0 = {1e6 / (600 * scale), 0};
+	source_t cam1 = {1e6 / (600 * scale), 7};
+	source_t adc = {1e6 / (1000 * scale), 13};
+	source_t poke_src[] = {
+		{1e6 / (100 * scale), 101},
+		{1e6 / (100 * scale), 211},
+		{1e6 / (100 * scale), 307},
+		{1e6 / (100 * scale), 401},
+	};
+
+	host_core_boot();
+	host_events_capture = false;
+
+	reg8 = B_EVT_PORT_DIS | B_EVT_PORT_DIOS_IN | B_EVT_DATA | B_EVT_CAM0 | B_EVT_CAM1;
+	app_write_REG_EVNT_ENABLE(&reg8);
+	reg16 = 600;
+	app_write_REG_CAM_OUT0_FREQ(&reg16);
+	app_write_REG_CAM_OUT1_FREQ(&reg16);
+	reg8 = B_EN_CAM_OUT0 | B_EN_CAM_OUT1;
+	app_write_REG_START_CAMERAS(&reg8);
+	PORTJ.IN |= (1 << 0);		// ADC1 available
+
+	host_events_clear();
+	host_uart_reset(buffer_size, baud / 10, late_us);
+	app_write_REG_TX_BUFFER_STATS(&reg16);
+
+	for (uint32_t now_us = 0; now_us < seconds * 1000000; now_us += STEP_US)
+	{
+		host_uart_drain(STEP_US);
+
+		if ((now_us % 500) == 0)
+			host_core_tick_500us();
+
+		if (source_due(&cam0, now_us))
+			TCF0_OVF_vect();
+		if (source_due(&cam1, now_us))
+			TCE0_OVF_vect();
+
+		if (source_due(&adc, now_us))
+		{
+			first_adc_channel = true;
+			ADCA_CH0_vect();
+			ADCA_CH0_vect();
+		}
+
+		for (uint8_t i = 0; i < 4; i++)
+		{
+			if (source_due(&poke_src[i], now_us))
+				poke_edge(&pokes[i]);
+			poke_service(&pokes[i]);
+		}
+	}
+
+	host_events_capture = true;
+
+	/* Events the firmware's TX buffer monitor refused never reach the model */
+	app_read_REG_TX_BUFFER_STATS();
+	host_uart.dropped += app_regs.REG_TX_BUFFER_STATS[1];
+
+	result->scale = scale;
+	result->seconds = seconds;
+	result->events = host_events_count;
+	result->bytes_per_second = (double)host_uart.bytes / seconds;
+	result->uart = host_uart;
+
+	host_uart.size = 0;
+}
+
+static void stress_print(const stress_result_t * result, uint16_t buffer_size)
+{
+	printf("%6.2f %10.0f %10.0f %10u %9u %9u %8.1f%% %8.2f ms\n",
+		result->scale, (double)result->events / result->seconds, result->bytes_per_second,
+		result->uart.dropped, result->uart.late, result->uart.high_water,
+		100.0 * result->uart.high_water / buffer_size, result->uart.max_delay_us / 1000);
+}
+
+static void usage(void)
+{
+	printf("usage: stress [-t seconds] [-b buffer bytes] [-r baud] [-l late us] [-g min events/s]\n");
+	printf("  -b  TX buffer size, at most TX_BUFFER_SIZE (default %u)\n", TX_BUFFER_SIZE);
+	printf("  -r  link rate, 8N1 (default 1000000)\n");
+	printf("  -l  a message queued behind more than this is late (default 5000)\n");
+	printf("  -g  fail if the sustainable rate is below this many events/s\n");
+}
+
+int main(int argc, char * argv[])
+{
+	uint32_t seconds = 5;
+	uint32_t buffer_size = TX_BUFFER_SIZE;
+	uint32_t baud = 1000000;
+	double late_us = 5000;
+	double gate = 0;
+	double sustainable = 0, sustainable_scale = 0;
+	stress_result_t result;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-t") && i + 1 < argc)
+			seconds = strtoul(argv[++i], 0, 0);
+		else if (!strcmp(argv[i], "-b") && i + 1 < argc)
+			buffer_size = strtoul(argv[++i], 0, 0);
+		else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+			baud = strtoul(argv[++i], 0, 0);
+		else if (!strcmp(argv[i], "-l") && i + 1 < argc)
+			late_us = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-g") && i + 1 < argc)
+			gate = atof(argv[++i]);
+		else
+		{
+			usage();
+			return 2;
+		}
+	}
+
+	if (buffer_size == 0 || buffer_size > TX_BUFFER_SIZE)
+	{
+		usage();
+		return 2;
+	}
+
+	printf("TX buffer %u bytes, link %u baud (%u bytes/s), late after %.0f us, %u s per step\n\n",
+		buffer_size, baud, baud / 10, late_us, seconds);
+	printf("%6s %10s %10s %10s %9s %9s %9s %11s\n",
+		"scale", "events/s", "bytes/s", "dropped", "late", "peak B", "peak %", "max delay");
+
+	/* Nominal mix first, then double it until the TX path can't keep up, then refine */
+	double low = 0, high = 0;
+
+	for (double scale = 1; scale <= 1024; scale *= 2)
+	{
+		stress_run(scale, seconds, buffer_size, baud, late_us, &result);
+
+		stress_print(&result, buffer_size);
+
+		if (result.uart.dropped || result.uart.late)
+		{
+			high = scale;
+			break;
+		}
+
+		low = scale;
+		sustainable = (double)result.events / seconds;
+		sustainable_scale = scale;
+	}
+
+	for (uint8_t i = 0; high && low && i < 6; i++)
+	{
+		double scale = (low + high) / 2;
+
+		stress_run(scale, seconds, buffer_size, baud, late_us, &result);
+
+		stress_print(&result, buffer_size);
+
+		if (result.uart.dropped || result.uart.late)
+			high = scale;
+		else
+		{
+			low = scale;
+			sustainable = (double)result.events / seconds;
+			sustainable_scale = scale;
+		}
+	}
+
+	printf("\nSustainable event rate: %.0f events/s (%.2fx the production mix)\n", sustainable, sustainable_scale);
+
+	if (gate && sustainable < gate)
+	{
+		printf("Below the required %.0f events/s\n", gate);
+		return 1;
+	}
+
+	return 0;
+}
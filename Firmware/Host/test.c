@@ -0,0 +1,474 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hwbp_core.h"
+#include "hwbp_core_types.h"
+#include "app_ios_and_regs.h"
+#include "app_funcs.h"
+
+#include "hwbp_core_host.h"
+
+/************************************************************************/
+/* Regression tests of the application on the host build                */
+/*                                                                      */
+/* Each test boots the device, drives the register handlers, ISRs and   */
+/* core ticks the way the hardware would, and checks the registers,     */
+/* outputs and events that come out. Any failed check fails the         */
+/* process, and with it "make test".                                    */
+/************************************************************************/
+extern AppRegs app_regs;
+
+void PORTD_INT0_vect(void);
+void PORTE_INT0_vect(void);
+void PORTF_INT0_vect(void);
+void PORTH_INT0_vect(void);
+void TCC1_CCB_vect(void);
+
+static uint32_t checks, failures;
+static const char * current_test;
+
+#define check(condition) test_check(!!(condition), #condition, __LINE__)
+
+static void test_check(bool passed, const char * condition, int line)
+{
+	checks++;
+
+	if (passed)
+		return;
+
+	failures++;
+	printf("FAIL %s, line %d: %s\n", current_test, line, condition);
+}
+
+/* The host keeps the application's RAM across boots, so the inputs the */
+/* last test left high are brought back low through their interrupts    */
+static void boot(void)
+{
+	host_core_boot();
+
+	PORTD_INT0_vect();
+	PORTE_INT0_vect();
+	PORTF_INT0_vect();
+	PORTH_INT0_vect();
+
+	host_events_clear();
+}
+
+/* Advances the core, latching the outputs the application wrote on every tick */
+static void run_ms(uint32_t ms)
+{
+	while (ms--)
+	{
+		host_core_tick_500us();
+		host_ports_latch();
+		host_core_tick_500us();
+		host_ports_latch();
+	}
+}
+
+/* Events of a register sent since the last host_events_clear(), oldest first */
+static uint32_t events_of(uint8_t add, host_event_t ** found, uint32_t max)
+{
+	uint32_t n = 0;
+
+	for (uint32_t i = 0; i < host_events_count && i < HOST_EVENT_LOG_SIZE; i++)
+	{
+		if (host_events[i].add != add)
+			continue;
+
+		if (n < max)
+			found[n] = &host_events[i];
+		n++;
+	}
+
+	return n;
+}
+
+static void enable_events(uint8_t mask)
+{
+	uint8_t reg = app_regs.REG_EVNT_ENABLE | mask;
+	app_write_REG_EVNT_ENABLE(&reg);
+}
+
+/************************************************************************/
+/* Pulse deadline queue                                                 */
+/************************************************************************/
+static void test_pulse_queue_order(void)
+{
+	uint8_t order[4], when[4], n = 0, channel;
+
+	boot();
+
+	/* The deadlines straddle the wrap of the tick counter */
+	pulse_tick = 65530;
+	pulse_schedule(PULSE_DO0, 9);
+	pulse_schedule(PULSE_DO1, 3);
+	pulse_schedule(PULSE_DO2, 6);
+	pulse_schedule(PULSE_LED0, 6);
+	pulse_schedule(PULSE_DO3, 2);
+	pulse_schedule(PULSE_DO3, 0);
+
+	for (uint8_t tick = 1; tick <= 12; tick++)
+	{
+		pulse_tick++;
+
+		while ((channel = pulse_pop_expired()) != PULSE_NONE && n < 4)
+		{
+			order[n] = channel;
+			when[n++] = tick;
+		}
+	}
+
+	check(n == 4);
+	check(order[0] == PULSE_DO1 && when[0] == 3);
+	check(order[1] == PULSE_DO2 && when[1] == 6);
+	check(order[2] == PULSE_LED0 && when[2] == 6);
+	check(order[3] == PULSE_DO0 && when[3] == 9);
+	check(pulse_queued == 0);
+}
+
+static void test_pulse_outputs(void)
+{
+	uint16_t reg;
+
+	boot();
+	reg = B_DO0 | B_DO1; app_write_REG_OUTPUT_PULSE_EN(&reg);
+	reg = 5; app_write_REG_PULSE_DO0(&reg);
+	reg = 2; app_write_REG_PULSE_DO1(&reg);
+
+	/* The tick counter wraps while the pulses run */
+	pulse_tick = 65533;
+
+	reg = B_DO0 | B_DO1;
+	app_write_REG_OUTPUTS_SET(&reg);
+	host_ports_latch();
+	check((PORTF.OUT & 1) && (PORTE.OUT & 1));
+
+	/* A pulse of N ms ends on the (N+1)th tick */
+	run_ms(2);
+	check((PORTF.OUT & 1) && (PORTE.OUT & 1));
+	run_ms(1);
+	check((PORTF.OUT & 1) && !(PORTE.OUT & 1));
+	run_ms(2);
+	check(PORTF.OUT & 1);
+	run_ms(1);
+	check(!(PORTF.OUT & 1));
+	check(pulse_queued == 0);
+}
+
+/************************************************************************/
+/* Pulse trains                                                         */
+/************************************************************************/
+static void test_train(void)
+{
+	uint16_t width[7], period[7], count[7], reg;
+	host_event_t * done[4];
+	uint32_t rises = 0;
+
+	boot();
+	enable_events(B_EVT_TRAIN_DONE);
+
+	for (uint8_t i = 0; i < 7; i++) { width[i] = 2; period[i] = 5; count[i] = 4; }
+	app_write_REG_TRAIN_WIDTH(width);
+	app_write_REG_TRAIN_PERIOD(period);
+	app_write_REG_TRAIN_COUNT(count);
+
+	reg = B_DO0;
+	period[3] = 2; app_write_REG_TRAIN_PERIOD(period);
+	check(!app_write_REG_TRAIN_START(&reg));
+	period[3] = 5; app_write_REG_TRAIN_PERIOD(period);
+
+	host_events_clear();
+	check(app_write_REG_TRAIN_START(&reg));
+
+	for (uint32_t ms = 0; ms < 40; ms++)
+	{
+		uint8_t before = PORTF.OUT & 1;
+		run_ms(1);
+		if (!before && (PORTF.OUT & 1))
+			rises++;
+	}
+
+	check(rises == 4);
+	check(!(PORTF.OUT & 1));
+	check(events_of(ADD_REG_TRAIN_DONE, done, 4) == 1);
+	check(done[0]->payload[0] == (B_DO0 & 0xFF) && done[0]->payload[1] == (B_DO0 >> 8));
+
+	/* Microsecond parts shorter than the minimum would keep the expiry busy */
+	reg = B_DO0; app_write_REG_PULSE_HIGH_RES(&reg);
+	width[3] = TRAIN_US_MIN - 1; period[3] = 1000;
+	app_write_REG_TRAIN_WIDTH(width);
+	app_write_REG_TRAIN_PERIOD(period);
+	check(!app_write_REG_TRAIN_START(&reg));
+}
+
+/************************************************************************/
+/* Output schedule                                                      */
+/************************************************************************/
+static void schedule_entry(uint16_t * w, uint32_t second, uint16_t usecond, uint16_t set, uint16_t clear)
+{
+	w[0] = second & 0xFFFF;
+	w[1] = second >> 16;
+	w[2] = usecond;
+	w[3] = set;
+	w[4] = clear;
+	w[5] = 0;
+}
+
+static void test_schedule(void)
+{
+	uint16_t w[48], bad[48], outputs[2];
+	host_event_t * done[8];
+
+	boot();
+	enable_events(B_EVT_SCHEDULE_DONE);
+	run_ms(10);
+
+	/* Uploaded out of order, played by timestamp */
+	memset(w, 0, sizeof(w));
+	schedule_entry(w + 0, 1, 600, B_DO2, 0);
+	schedule_entry(w + 6, 1, 200, B_DO0, 0);
+	schedule_entry(w + 12, 1, 400, B_DO1, 0);
+	check(app_write_REG_SCHEDULE_ADD(w));
+
+	app_read_REG_SCHEDULE_DEPTH();
+	check(app_regs.REG_SCHEDULE_DEPTH == 3);
+
+	/* One bad entry rejects the whole upload */
+	memset(bad, 0, sizeof(bad));
+	schedule_entry(bad + 0, 2, 0, B_DO3, 0);
+	schedule_entry(bad + 6, 2, 31250, B_DO3, 0);
+	check(!app_write_REG_SCHEDULE_ADD(bad));
+
+	app_read_REG_SCHEDULE_DEPTH();
+	check(app_regs.REG_SCHEDULE_DEPTH == 3);
+
+	host_events_clear();
+	run_ms(1100);
+
+	/* Each event holds the outputs and the operations left */
+	check(events_of(ADD_REG_SCHEDULE_DONE, done, 8) == 3);
+	memcpy(outputs, done[0]->payload, sizeof(outputs));
+	check(outputs[0] == B_DO0 && outputs[1] == 2);
+	memcpy(outputs, done[1]->payload, sizeof(outputs));
+	check(outputs[0] == (B_DO0 | B_DO1) && outputs[1] == 1);
+	memcpy(outputs, done[2]->payload, sizeof(outputs));
+	check(outputs[0] == (B_DO0 | B_DO1 | B_DO2) && outputs[1] == 0);
+	check(done[0]->usecond < done[1]->usecond && done[1]->usecond < done[2]->usecond);
+	check((PORTF.OUT & 1) && (PORTE.OUT & 1) && (PORTD.OUT & 1));
+	check(!(PORTC.OUT & 1));
+}
+
+/************************************************************************/
+/* Register transactions                                                */
+/************************************************************************/
+static void test_transaction(void)
+{
+	uint8_t t[64];
+
+	boot();
+
+	uint16_t pulse0 = app_regs.REG_PULSE_DO0;
+	uint16_t pulse1 = app_regs.REG_PULSE_DO1;
+
+	/* PULSE_DO0 = 7 is valid, PULSE_DO1 = 0 is not, so neither is written */
+	memset(t, 0, sizeof(t));
+	t[0] = ADD_REG_PULSE_DO0; t[1] = TYPE_U16; t[2] = 7; t[3] = 0;
+	t[4] = ADD_REG_PULSE_DO1; t[5] = TYPE_U16; t[6] = 0; t[7] = 0;
+	check(!app_write_REG_TRANSACTION(t));
+	check(app_regs.REG_PULSE_DO0 == pulse0 && app_regs.REG_PULSE_DO1 == pulse1);
+
+	/* A wrong type rejects it as well */
+	t[6] = 9; t[5] = TYPE_U8;
+	check(!app_write_REG_TRANSACTION(t));
+	check(app_regs.REG_PULSE_DO0 == pulse0);
+
+	t[5] = TYPE_U16;
+	check(app_write_REG_TRANSACTION(t));
+	check(app_regs.REG_PULSE_DO0 == 7 && app_regs.REG_PULSE_DO1 == 9);
+}
+
+/************************************************************************/
+/* Input debounce                                                       */
+/************************************************************************/
+static void test_debounce(void)
+{
+	uint32_t rise[4] = {5000, 0, 0, 0}, fall[4] = {5000, 0, 0, 0};
+	host_event_t * dis[8];
+
+	boot();
+	enable_events(B_EVT_PORT_DIS);
+	app_write_REG_DI_DEBOUNCE_RISE(rise);
+	app_write_REG_DI_DEBOUNCE_FALL(fall);
+	run_ms(2);
+	host_events_clear();
+
+	/* DI0 rises and bounces while held off */
+	host_set_pin(&PORTD, 4, 1); PORTD_INT0_vect();
+	host_set_pin(&PORTD, 4, 0); PORTD_INT0_vect();
+	host_set_pin(&PORTD, 4, 1); PORTD_INT0_vect();
+	host_set_pin(&PORTD, 4, 0); PORTD_INT0_vect();
+
+	/* DI3 isn't blinded by it */
+	run_ms(1);
+	host_set_pin(&PORTH, 0, 1); PORTH_INT0_vect();
+
+	check(events_of(ADD_REG_PORT_DIS, dis, 8) == 2);
+	check(dis[0]->payload[0] == B_DI0);
+	check(dis[1]->payload[0] == (B_DI0 | B_DI3));
+
+	/* DI0 settled low, which the compare re-samples when the hold-off ends */
+	check((TCC1.INTCTRLB & TC_CCBINTLVL_gm) == TC_CCBINTLVL_LO_gc);
+	TCC1.CNT = TCC1.CCB - 1;
+	TCC1_CCB_vect();
+	check(events_of(ADD_REG_PORT_DIS, dis, 8) == 2);
+	TCC1.CNT = TCC1.CCB;
+	TCC1_CCB_vect();
+	check(events_of(ADD_REG_PORT_DIS, dis, 8) == 3);
+	check(dis[2]->payload[0] == B_DI3);
+
+	/* The reported fall holds the line off in turn */
+	check(di_holding == B_DI0);
+	run_ms(14);
+	check(di_holding == 0);
+	check(!(TCC1.INTCTRLB & TC_CCBINTLVL_gm));
+}
+
+/************************************************************************/
+/* Input edge FIFO                                                      */
+/************************************************************************/
+static void test_edge_fifo(void)
+{
+	host_event_t * fifo[8];
+	uint32_t edges[EDGE_FIFO_EVENT_EDGES];
+	bool lost_first = false, lost_later = false;
+
+	boot();
+	uint8_t reg = B_DI3;
+	check(app_write_REG_EDGE_FIFO_EN(&reg));
+	reg = 0x10;
+	check(!app_write_REG_EDGE_FIFO_EN(&reg));
+	run_ms(2);
+
+	/* Two edges fit and are sent on the next tick */
+	host_events_clear();
+	host_set_pin(&PORTH, 0, 1); PORTH_INT0_vect();
+	host_set_pin(&PORTH, 0, 0); PORTH_INT0_vect();
+	run_ms(1);
+
+	check(events_of(ADD_REG_EDGE_FIFO, fifo, 8) == 1);
+	memcpy(edges, fifo[0]->payload, sizeof(edges));
+	check((edges[0] & MSK_EDGE_LINE) == B_DI3 && (edges[0] & B_EDGE_RISING));
+	check((edges[1] & MSK_EDGE_LINE) == B_DI3 && !(edges[1] & B_EDGE_RISING));
+	check(!((edges[0] | edges[1]) & B_EDGE_LOST));
+
+	/* More edges than the FIFO holds before the tick drains it */
+	host_events_clear();
+	for (uint8_t i = 0; i < EDGE_FIFO_CAPACITY + 8; i++)
+	{
+		host_set_pin(&PORTH, 0, !(i & 1));
+		PORTH_INT0_vect();
+	}
+	check(edge_fifo_queued == EDGE_FIFO_CAPACITY);
+
+	/* The next edge after the drain carries the loss */
+	run_ms(1);
+	host_set_pin(&PORTH, 0, 1); PORTH_INT0_vect();
+	run_ms(1);
+
+	uint32_t n = events_of(ADD_REG_EDGE_FIFO, fifo, 8);
+	check(n >= 2);
+
+	for (uint32_t i = 0; i < n && i < 8; i++)
+	{
+		memcpy(edges, fifo[i]->payload, sizeof(edges));
+
+		for (uint8_t j = 0; j < EDGE_FIFO_EVENT_EDGES; j++)
+		{
+			if (!edges[j])
+				continue;
+			if (i == 0 && j == 0)
+				lost_first = !!(edges[j] & B_EDGE_LOST);
+			else if (edges[j] & B_EDGE_LOST)
+				lost_later = true;
+		}
+	}
+
+	check(lost_later && !lost_first);
+}
+
+/************************************************************************/
+/* Edge counters                                                        */
+/************************************************************************/
+static void test_edge_counts(void)
+{
+	host_event_t * counts[8];
+	uint32_t v[12];
+
+	boot();
+	uint16_t window = 10;
+	check(app_write_REG_EDGE_COUNT_WINDOW(&window));
+	window = 0;
+	check(!app_write_REG_EDGE_COUNT_WINDOW(&window));
+
+	host_events_clear();
+	uint8_t reg = B_DI3;
+	app_write_REG_EDGE_COUNT_RISING(&reg);
+
+	for (uint8_t i = 0; i < 6; i++)
+	{
+		host_set_pin(&PORTH, 0, 1); PORTH_INT0_vect();
+		host_set_pin(&PORTH, 0, 0); PORTH_INT0_vect();
+	}
+
+	run_ms(25);
+
+	check(events_of(ADD_REG_EDGE_COUNTS, counts, 8) == 2);
+	memcpy(v, counts[0]->payload, sizeof(v));
+	check(v[3] == 6 && v[0] == 0);
+	memcpy(v, counts[1]->payload, sizeof(v));
+	check(v[3] == 0);
+
+	reg = 0;
+	app_write_REG_EDGE_COUNT_RISING(&reg);
+	host_events_clear();
+	run_ms(30);
+	check(events_of(ADD_REG_EDGE_COUNTS, counts, 8) == 0);
+}
+
+/************************************************************************/
+/* Main                                                                 */
+/************************************************************************/
+typedef struct
+{
+	const char * name;
+	void (*run)(void);
+} test_case_t;
+
+static const test_case_t tests[] = {
+	{"pulse_queue_order",	test_pulse_queue_order},
+	{"pulse_outputs",		test_pulse_outputs},
+	{"train",				test_train},
+	{"schedule",			test_schedule},
+	{"transaction",			test_transaction},
+	{"debounce",			test_debounce},
+	{"edge_fifo",			test_edge_fifo},
+	{"edge_counts",			test_edge_counts},
+};
+
+int main(void)
+{
+	for (uint8_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++)
+	{
+		uint32_t failures_before = failures;
+
+		current_test = tests[i].name;
+		tests[i].run();
+
+		printf("%-20s %s\n", tests[i].name, failures == failures_before ? "ok" : "FAILED");
+	}
+
+	printf("%u checks, %u failed\n", checks, failures);
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
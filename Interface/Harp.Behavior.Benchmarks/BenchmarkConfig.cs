@@ -0,0 +1,27 @@
+using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Diagnosers;
+
+namespace Harp.Behavior.Benchmarks
+{
+    /// <summary>
+    /// Represents the configuration shared by all parser benchmarks, which report
+    /// messages per second and bytes allocated per message.
+    /// </summary>
+    public class BenchmarkConfig : ManualConfig
+    {
+        /// <summary>
+        /// The number of messages decoded by each benchmark invocation.
+        /// </summary>
+        public const int MessagesPerInvoke = 4096;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="BenchmarkConfig"/> class.
+        /// </summary>
+        public BenchmarkConfig()
+        {
+            AddDiagnoser(MemoryDiagnoser.Default);
+            AddColumn(new ThroughputColumn());
+            AddLogicalGroupRules(BenchmarkLogicalGroupRule.ByCategory);
+        }
+    }
+}
@@ -0,0 +1,144 @@
+using Bonsai.Harp;
+using System;
+using System.Collections.Generic;
+using System.IO;
+
+namespace Harp.Behavior.Benchmarks
+{
+    /// <summary>
+    /// Provides the Behavior message stream replayed by the parser benchmarks.
+    /// </summary>
+    public static class HarpStream
+    {
+        /// <summary>
+        /// The name of the environment variable holding the path to a recorded
+        /// binary Harp stream. The benchmark processes inherit it from the host.
+        /// </summary>
+        public const string PathVariable = "HARP_BEHAVIOR_STREAM";
+
+        /// <summary>
+        /// The number of seconds of the production mix synthesized when no
+        /// recorded stream is specified.
+        /// </summary>
+        public const int SynthesizedSeconds = 10;
+
+        /// <summary>
+        /// Loads the recorded stream named by <see cref="PathVariable"/>, or
+        /// synthesizes the production mix if the variable is not set.
+        /// </summary>
+        /// <returns>The sequence of Harp messages in arrival order.</returns>
+        public static HarpMessage[] Load()
+        {
+            var path = Environment.GetEnvironmentVariable(PathVariable);
+            return string.IsNullOrEmpty(path) ? Synthesize(SynthesizedSeconds) : Read(path);
+        }
+
+        /// <summary>
+        /// Splits a recorded binary Harp stream, e.g. a file written by the
+        /// Bonsai.Harp MessageWriter, into individual messages.
+        /// </summary>
+        /// <param name="path">The path to the binary stream file.</param>
+        /// <returns>The sequence of Harp messages stored in the file.</returns>
+        public static HarpMessage[] Read(string path)
+        {
+            var buffer = File.ReadAllBytes(path);
+            var messages = new List<HarpMessage>();
+
+            var offset = 0;
+            while (offset + 2 <= buffer.Length)
+            {
+                if (buffer[offset + 1] == byte.MaxValue)
+                {
+                    throw new InvalidDataException($"Extended length message at offset {offset} is not supported.");
+                }
+
+                // The length byte counts everything after itself, checksum included
+                var length = buffer[offset + 1] + 2;
+                if (offset + length > buffer.Length)
+                {
+                    break;
+                }
+
+                var messageBytes = new byte[length];
+                Buffer.BlockCopy(buffer, offset, messageBytes, 0, length);
+                var message = new HarpMessage(messageBytes);
+                if (!message.IsValid)
+                {
+                    throw new InvalidDataException($"Invalid Harp message at offset {offset}.");
+                }
+
+                messages.Add(message);
+                offset += length;
+            }
+
+            if (messages.Count == 0)
+            {
+                throw new InvalidDataException($"The file '{path}' does not contain any Harp messages.");
+            }
+
+            return messages.ToArray();
+        }
+
+        /// <summary>
+        /// Synthesizes the production event mix: both cameras at 600 Hz, analog
+        /// data at 1 kHz, and the three pokes plus DI3 and the DIO port toggling
+        /// at 100 Hz each.
+        /// </summary>
+        /// <param name="seconds">The duration of the stream, in seconds.</param>
+        /// <returns>The sequence of Harp messages ordered by timestamp.</returns>
+        public static HarpMessage[] Synthesize(int seconds)
+        {
+            var sources = new List<(double Period, double Offset, Func<double, int, HarpMessage> Create)>
+            {
+                (1.0 / 600, 0, (timestamp, n) => Camera0Frame.FromPayload(timestamp, MessageType.Event, FrameAcquired.FrameAcquired)),
+                (1.0 / 600, 7e-6, (timestamp, n) => Camera1Frame.FromPayload(timestamp, MessageType.Event, FrameAcquired.FrameAcquired)),
+                (1.0 / 1000, 13e-6, (timestamp, n) => AnalogData.FromPayload(timestamp, MessageType.Event,
+                    new AnalogDataPayload((short)(2048 + n % 1024), (short)n, (short)(1024 - n % 512)))),
+                (1.0 / 400, 101e-6, (timestamp, n) => DigitalInputState.FromPayload(timestamp, MessageType.Event,
+                    (DigitalInputs)(n % 16))),
+                (1.0 / 100, 211e-6, (timestamp, n) => PortDIOStateEvent.FromPayload(timestamp, MessageType.Event,
+                    (PortDigitalIOS)(n % 8)))
+            };
+
+            var messages = new List<(double Timestamp, HarpMessage Message)>();
+            foreach (var source in sources)
+            {
+                var count = (int)(seconds / source.Period);
+                for (int n = 0; n < count; n++)
+                {
+                    var timestamp = source.Offset + n * source.Period;
+                    messages.Add((timestamp, source.Create(timestamp, n)));
+                }
+            }
+
+            messages.Sort((x, y) => x.Timestamp.CompareTo(y.Timestamp));
+            return messages.ConvertAll(x => x.Message).ToArray();
+        }
+
+        /// <summary>
+        /// Returns the event messages from the specified register, repeated in
+        /// order until the result holds the specified number of messages.
+        /// </summary>
+        /// <param name="messages">The sequence of Harp messages to filter.</param>
+        /// <param name="address">The address of the register to select, or -1 to keep all messages.</param>
+        /// <param name="count">The number of messages in the result.</param>
+        /// <returns>An array with exactly <paramref name="count"/> messages.</returns>
+        public static HarpMessage[] Repeat(HarpMessage[] messages, int address, int count)
+        {
+            var selected = Array.FindAll(messages, message =>
+                address < 0 || message.Address == address && message.MessageType == MessageType.Event);
+            if (selected.Length == 0)
+            {
+                throw new InvalidOperationException($"The stream does not contain any events from register {address}.");
+            }
+
+            var result = new HarpMessage[count];
+            for (int i = 0; i < result.Length; i++)
+            {
+                result[i] = selected[i % selected.Length];
+            }
+
+            return result;
+        }
+    }
+}
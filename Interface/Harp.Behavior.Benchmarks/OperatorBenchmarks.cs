@@ -0,0 +1,128 @@
+using BenchmarkDotNet.Attributes;
+using Bonsai.Harp;
+using System;
+using System.Linq.Expressions;
+using System.Reactive.Disposables;
+using System.Reactive.Subjects;
+
+namespace Harp.Behavior.Benchmarks
+{
+    /// <summary>
+    /// Replays the whole device stream through the generated Parse operator, built
+    /// the same way a Bonsai workflow builds it, so the measurement includes the
+    /// register filter and the observable plumbing as well as payload decoding.
+    /// </summary>
+    [Config(typeof(BenchmarkConfig))]
+    public class OperatorBenchmarks
+    {
+        const int MessagesPerInvoke = BenchmarkConfig.MessagesPerInvoke;
+
+        /// <summary>
+        /// The register parsed from the stream, or All to subscribe one Parse
+        /// operator per register at once, as a workflow decoding the device does.
+        /// </summary>
+        [Params("DigitalInputState", "PortDIOStateEvent", "AnalogData", "Camera0Frame", "Camera1Frame", "All")]
+        public string Register { get; set; }
+
+        /// <summary>
+        /// Whether the operator selects timestamped payloads.
+        /// </summary>
+        [Params(false, true)]
+        public bool Timestamped { get; set; }
+
+        HarpMessage[] messages;
+        Subject<HarpMessage> source;
+        IDisposable subscription;
+        long parsed;
+
+        /// <summary>
+        /// Loads the stream and subscribes the Parse operators to the replay source.
+        /// </summary>
+        [GlobalSetup]
+        public void Setup()
+        {
+            var stream = HarpStream.Load();
+            messages = HarpStream.Repeat(stream, -1, MessagesPerInvoke);
+            source = new Subject<HarpMessage>();
+
+            var registers = Register == "All"
+                ? new[] { "DigitalInputState", "PortDIOStateEvent", "AnalogData", "Camera0Frame", "Camera1Frame" }
+                : new[] { Register };
+            var subscriptions = new CompositeDisposable();
+            foreach (var name in registers)
+            {
+                subscriptions.Add(CreateParser(name)(source));
+            }
+            subscription = subscriptions;
+
+            // Fail early if the stream has nothing for the selected register
+            Replay();
+            if (parsed == 0)
+            {
+                throw new InvalidOperationException($"No {Register} messages were parsed from the stream.");
+            }
+        }
+
+        /// <summary>
+        /// Disposes the Parse operators.
+        /// </summary>
+        [GlobalCleanup]
+        public void Cleanup()
+        {
+            subscription.Dispose();
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        public void Replay()
+        {
+            var stream = messages;
+            var observer = source;
+            for (int i = 0; i < stream.Length; i++)
+            {
+                observer.OnNext(stream[i]);
+            }
+        }
+
+        Func<IObservable<HarpMessage>, IDisposable> CreateParser(string name)
+        {
+            var typeName = $"{typeof(AnalogData).Namespace}.{(Timestamped ? "Timestamped" : string.Empty)}{name}";
+            var registerType = typeof(AnalogData).Assembly.GetType(typeName, throwOnError: true);
+            var parse = new Parse { Register = Activator.CreateInstance(registerType) };
+
+            var parameter = Expression.Parameter(typeof(IObservable<HarpMessage>), "source");
+            var output = parse.Build(new[] { parameter });
+            var payloadType = output.Type.GetGenericArguments()[0];
+            var body = Expression.Call(Expression.Constant(this), nameof(Subscribe), new[] { payloadType }, output);
+            return Expression.Lambda<Func<IObservable<HarpMessage>, IDisposable>>(body, parameter).Compile();
+        }
+
+        IDisposable Subscribe<TPayload>(IObservable<TPayload> payloads)
+        {
+            return payloads.Subscribe(new PayloadObserver<TPayload>(this));
+        }
+
+        class PayloadObserver<TPayload> : IObserver<TPayload>
+        {
+            readonly OperatorBenchmarks owner;
+
+            public PayloadObserver(OperatorBenchmarks benchmarks)
+            {
+                owner = benchmarks;
+            }
+
+            public void OnNext(TPayload value)
+            {
+                owner.parsed++;
+            }
+
+            public void OnError(Exception error)
+            {
+                throw error;
+            }
+
+            public void OnCompleted()
+            {
+            }
+        }
+    }
+}
@@ -0,0 +1,192 @@
+using BenchmarkDotNet.Attributes;
+using Bonsai.Harp;
+
+namespace Harp.Behavior.Benchmarks
+{
+    /// <summary>
+    /// Measures the generated GetPayload and GetTimestampedPayload methods in
+    /// isolation, on the messages of each register in the replayed stream, next
+    /// to the allocation-free ReadPayload paths where the generated ones allocate.
+    /// </summary>
+    [Config(typeof(BenchmarkConfig))]
+    public class PayloadBenchmarks
+    {
+        const int MessagesPerInvoke = BenchmarkConfig.MessagesPerInvoke;
+
+        HarpMessage[] digitalInputState;
+        HarpMessage[] portDIOStateEvent;
+        HarpMessage[] analogData;
+        HarpMessage[] camera0Frame;
+        HarpMessage[] camera1Frame;
+
+        /// <summary>
+        /// Loads the stream and selects the messages of each register.
+        /// </summary>
+        [GlobalSetup]
+        public void Setup()
+        {
+            var stream = HarpStream.Load();
+            digitalInputState = HarpStream.Repeat(stream, DigitalInputState.Address, MessagesPerInvoke);
+            portDIOStateEvent = HarpStream.Repeat(stream, PortDIOStateEvent.Address, MessagesPerInvoke);
+            analogData = HarpStream.Repeat(stream, AnalogData.Address, MessagesPerInvoke);
+            camera0Frame = HarpStream.Repeat(stream, Camera0Frame.Address, MessagesPerInvoke);
+            camera1Frame = HarpStream.Repeat(stream, Camera1Frame.Address, MessagesPerInvoke);
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        [BenchmarkCategory(nameof(DigitalInputState))]
+        public DigitalInputs GetDigitalInputState()
+        {
+            DigitalInputs result = default;
+            var messages = digitalInputState;
+            for (int i = 0; i < messages.Length; i++)
+            {
+                result = DigitalInputState.GetPayload(messages[i]);
+            }
+            return result;
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        [BenchmarkCategory(nameof(DigitalInputState))]
+        public Timestamped<DigitalInputs> GetTimestampedDigitalInputState()
+        {
+            Timestamped<DigitalInputs> result = default;
+            var messages = digitalInputState;
+            for (int i = 0; i < messages.Length; i++)
+            {
+                result = DigitalInputState.GetTimestampedPayload(messages[i]);
+            }
+            return result;
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        [BenchmarkCategory(nameof(PortDIOStateEvent))]
+        public PortDigitalIOS GetPortDIOStateEvent()
+        {
+            PortDigitalIOS result = default;
+            var messages = portDIOStateEvent;
+            for (int i = 0; i < messages.Length; i++)
+            {
+                result = PortDIOStateEvent.GetPayload(messages[i]);
+            }
+            return result;
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        [BenchmarkCategory(nameof(PortDIOStateEvent))]
+        public Timestamped<PortDigitalIOS> GetTimestampedPortDIOStateEvent()
+        {
+            Timestamped<PortDigitalIOS> result = default;
+            var messages = portDIOStateEvent;
+            for (int i = 0; i < messages.Length; i++)
+            {
+                result = PortDIOStateEvent.GetTimestampedPayload(messages[i]);
+            }
+            return result;
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        [BenchmarkCategory(nameof(AnalogData))]
+        public AnalogDataPayload GetAnalogData()
+        {
+            AnalogDataPayload result = default;
+            var messages = analogData;
+            for (int i = 0; i < messages.Length; i++)
+            {
+                result = AnalogData.GetPayload(messages[i]);
+            }
+            return result;
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        [BenchmarkCategory(nameof(AnalogData))]
+        public Timestamped<AnalogDataPayload> GetTimestampedAnalogData()
+        {
+            Timestamped<AnalogDataPayload> result = default;
+            var messages = analogData;
+            for (int i = 0; i < messages.Length; i++)
+            {
+                result = AnalogData.GetTimestampedPayload(messages[i]);
+            }
+            return result;
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        [BenchmarkCategory(nameof(AnalogData))]
+        public AnalogDataPayload ReadAnalogData()
+        {
+            AnalogDataPayload result = default;
+            var messages = analogData;
+            for (int i = 0; i < messages.Length; i++)
+            {
+                result = AnalogData.ReadPayload(messages[i]);
+            }
+            return result;
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        [BenchmarkCategory(nameof(AnalogData))]
+        public Timestamped<AnalogDataPayload> ReadTimestampedAnalogData()
+        {
+            Timestamped<AnalogDataPayload> result = default;
+            var messages = analogData;
+            for (int i = 0; i < messages.Length; i++)
+            {
+                result = AnalogData.ReadTimestampedPayload(messages[i]);
+            }
+            return result;
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        [BenchmarkCategory(nameof(Camera0Frame))]
+        public FrameAcquired GetCamera0Frame()
+        {
+            FrameAcquired result = default;
+            var messages = camera0Frame;
+            for (int i = 0; i < messages.Length; i++)
+            {
+                result = Camera0Frame.GetPayload(messages[i]);
+            }
+            return result;
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        [BenchmarkCategory(nameof(Camera0Frame))]
+        public Timestamped<FrameAcquired> GetTimestampedCamera0Frame()
+        {
+            Timestamped<FrameAcquired> result = default;
+            var messages = camera0Frame;
+            for (int i = 0; i < messages.Length; i++)
+            {
+                result = Camera0Frame.GetTimestampedPayload(messages[i]);
+            }
+            return result;
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        [BenchmarkCategory(nameof(Camera1Frame))]
+        public FrameAcquired GetCamera1Frame()
+        {
+            FrameAcquired result = default;
+            var messages = camera1Frame;
+            for (int i = 0; i < messages.Length; i++)
+            {
+                result = Camera1Frame.GetPayload(messages[i]);
+            }
+            return result;
+        }
+
+        [Benchmark(OperationsPerInvoke = MessagesPerInvoke)]
+        [BenchmarkCategory(nameof(Camera1Frame))]
+        public Timestamped<FrameAcquired> GetTimestampedCamera1Frame()
+        {
+            Timestamped<FrameAcquired> result = default;
+            var messages = camera1Frame;
+            for (int i = 0; i < messages.Length; i++)
+            {
+                result = Camera1Frame.GetTimestampedPayload(messages[i]);
+            }
+            return result;
+        }
+    }
+}
@@ -0,0 +1,30 @@
+using BenchmarkDotNet.Running;
+using System;
+using System.IO;
+using System.Linq;
+
+namespace Harp.Behavior.Benchmarks
+{
+    class Program
+    {
+        static int Main(string[] args)
+        {
+            // The stream path reaches the benchmark processes through the environment
+            var index = Array.IndexOf(args, "--stream");
+            if (index >= 0)
+            {
+                if (index + 1 >= args.Length || !File.Exists(args[index + 1]))
+                {
+                    Console.Error.WriteLine("usage: Harp.Behavior.Benchmarks [--stream <recorded.bin>] [BenchmarkDotNet options]");
+                    return 2;
+                }
+
+                Environment.SetEnvironmentVariable(HarpStream.PathVariable, Path.GetFullPath(args[index + 1]));
+                args = args.Take(index).Concat(args.Skip(index + 2)).ToArray();
+            }
+
+            var summaries = BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args);
+            return summaries.Any(summary => summary.HasCriticalValidationErrors) ? 1 : 0;
+        }
+    }
+}
@@ -0,0 +1,66 @@
+using BenchmarkDotNet.Columns;
+using BenchmarkDotNet.Reports;
+using BenchmarkDotNet.Running;
+
+namespace Harp.Behavior.Benchmarks
+{
+    /// <summary>
+    /// Represents a summary column reporting the number of messages decoded per
+    /// second, derived from the mean time per operation. Every benchmark in this
+    /// project counts one operation per message.
+    /// </summary>
+    public class ThroughputColumn : IColumn
+    {
+        /// <inheritdoc/>
+        public string Id => nameof(ThroughputColumn);
+
+        /// <inheritdoc/>
+        public string ColumnName => "Msg/s";
+
+        /// <inheritdoc/>
+        public bool AlwaysShow => true;
+
+        /// <inheritdoc/>
+        public ColumnCategory Category => ColumnCategory.Statistics;
+
+        /// <inheritdoc/>
+        public int PriorityInCategory => 0;
+
+        /// <inheritdoc/>
+        public bool IsNumeric => true;
+
+        /// <inheritdoc/>
+        public UnitType UnitType => UnitType.Dimensionless;
+
+        /// <inheritdoc/>
+        public string Legend => "Messages decoded per second by a single thread";
+
+        /// <inheritdoc/>
+        public string GetValue(Summary summary, BenchmarkCase benchmarkCase)
+        {
+            return GetValue(summary, benchmarkCase, summary.Style);
+        }
+
+        /// <inheritdoc/>
+        public string GetValue(Summary summary, BenchmarkCase benchmarkCase, SummaryStyle style)
+        {
+            var statistics = summary[benchmarkCase]?.ResultStatistics;
+            if (statistics == null || statistics.Mean <= 0)
+            {
+                return "NA";
+            }
+
+            // Mean is in nanoseconds per operation
+            return (1e9 / statistics.Mean).ToString("N0", style.CultureInfo);
+        }
+
+        /// <inheritdoc/>
+        public bool IsAvailable(Summary summary) => true;
+
+        /// <inheritdoc/>
+        public bool IsDefault(Summary summary, BenchmarkCase benchmarkCase) => false;
+
+        /// <inheritdoc/>
+        public override string ToString() => ColumnName;
+    }
+}
@@ -0,0 +1,205 @@
+﻿using Bonsai.Harp;
+using System;
+using System.Buffers.Binary;
+
+namespace Harp.Behavior
+{
+    /// <summary>
+    /// Provides methods for locating the payload and timestamp of raw Harp
+    /// messages without copying or allocating.
+    /// </summary>
+    internal static class PayloadReader
+    {
+        const int HeaderSize = 5;
+        const int TimestampSize = 6;
+        const int ChecksumSize = 1;
+
+        /// <summary>
+        /// Returns whether the raw message carries a timestamp.
+        /// </summary>
+        public static bool IsTimestamped(ReadOnlySpan<byte> messageBytes)
+        {
+            return ((PayloadType)messageBytes[4] & PayloadType.Timestamp) != 0;
+        }
+
+        /// <summary>
+        /// Returns the payload bytes of the raw message, excluding the checksum.
+        /// </summary>
+        public static ReadOnlySpan<byte> GetPayload(ReadOnlySpan<byte> messageBytes)
+        {
+            var offset = IsTimestamped(messageBytes) ? HeaderSize + TimestampSize : HeaderSize;
+            return messageBytes.Slice(offset, messageBytes.Length - offset - ChecksumSize);
+        }
+
+        /// <summary>
+        /// Returns the timestamp of the raw message, in seconds.
+        /// </summary>
+        public static double GetTimestamp(ReadOnlySpan<byte> messageBytes)
+        {
+            if (!IsTimestamped(messageBytes))
+            {
+                throw new InvalidOperationException("The Harp message does not have a timestamp.");
+            }
+
+            var seconds = BinaryPrimitives.ReadUInt32LittleEndian(messageBytes.Slice(HeaderSize));
+            var microseconds = BinaryPrimitives.ReadUInt16LittleEndian(messageBytes.Slice(HeaderSize + 4));
+            return seconds + microseconds * 32e-6;
+        }
+    }
+
+    public partial class DigitalInputState
+    {
+        /// <summary>
+        /// Returns the payload data for <see cref="DigitalInputState"/> register messages
+        /// stored in a raw message buffer, without allocating.
+        /// </summary>
+        /// <param name="messageBytes">The bytes of a complete Harp message, including the checksum.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputs ReadPayload(ReadOnlySpan<byte> messageBytes)
+        {
+            return (DigitalInputs)PayloadReader.GetPayload(messageBytes)[0];
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DigitalInputState"/> register
+        /// messages stored in a raw message buffer, without allocating.
+        /// </summary>
+        /// <param name="messageBytes">The bytes of a complete Harp message, including the checksum.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> ReadTimestampedPayload(ReadOnlySpan<byte> messageBytes)
+        {
+            return Timestamped.Create(ReadPayload(messageBytes), PayloadReader.GetTimestamp(messageBytes));
+        }
+    }
+
+    public partial class PortDIOStateEvent
+    {
+        /// <summary>
+        /// Returns the payload data for <see cref="PortDIOStateEvent"/> register messages
+        /// stored in a raw message buffer, without allocating.
+        /// </summary>
+        /// <param name="messageBytes">The bytes of a complete Harp message, including the checksum.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PortDigitalIOS ReadPayload(ReadOnlySpan<byte> messageBytes)
+        {
+            return (PortDigitalIOS)PayloadReader.GetPayload(messageBytes)[0];
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PortDIOStateEvent"/> register
+        /// messages stored in a raw message buffer, without allocating.
+        /// </summary>
+        /// <param name="messageBytes">The bytes of a complete Harp message, including the checksum.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PortDigitalIOS> ReadTimestampedPayload(ReadOnlySpan<byte> messageBytes)
+        {
+            return Timestamped.Create(ReadPayload(messageBytes), PayloadReader.GetTimestamp(messageBytes));
+        }
+    }
+
+    public partial class AnalogData
+    {
+        static AnalogDataPayload ParsePayload(ReadOnlySpan<byte> payload)
+        {
+            AnalogDataPayload result;
+            result.AnalogInput0 = BinaryPrimitives.ReadInt16LittleEndian(payload);
+            result.Encoder = BinaryPrimitives.ReadInt16LittleEndian(payload.Slice(2));
+            result.AnalogInput1 = BinaryPrimitives.ReadInt16LittleEndian(payload.Slice(4));
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogData"/> register messages without
+        /// allocating an intermediate payload array, unlike <see cref="GetPayload"/>.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogDataPayload ReadPayload(HarpMessage message)
+        {
+            return ReadPayload(message.MessageBytes);
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogData"/> register messages stored
+        /// in a raw message buffer, without allocating.
+        /// </summary>
+        /// <param name="messageBytes">The bytes of a complete Harp message, including the checksum.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogDataPayload ReadPayload(ReadOnlySpan<byte> messageBytes)
+        {
+            return ParsePayload(PayloadReader.GetPayload(messageBytes));
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogData"/> register messages
+        /// without allocating an intermediate payload array, unlike <see cref="GetTimestampedPayload"/>.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogDataPayload> ReadTimestampedPayload(HarpMessage message)
+        {
+            return ReadTimestampedPayload(message.MessageBytes);
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogData"/> register messages
+        /// stored in a raw message buffer, without allocating.
+        /// </summary>
+        /// <param name="messageBytes">The bytes of a complete Harp message, including the checksum.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogDataPayload> ReadTimestampedPayload(ReadOnlySpan<byte> messageBytes)
+        {
+            return Timestamped.Create(ReadPayload(messageBytes), PayloadReader.GetTimestamp(messageBytes));
+        }
+    }
+
+    public partial class Camera0Frame
+    {
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera0Frame"/> register messages
+        /// stored in a raw message buffer, without allocating.
+        /// </summary>
+        /// <param name="messageBytes">The bytes of a complete Harp message, including the checksum.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static FrameAcquired ReadPayload(ReadOnlySpan<byte> messageBytes)
+        {
+            return (FrameAcquired)PayloadReader.GetPayload(messageBytes)[0];
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera0Frame"/> register
+        /// messages stored in a raw message buffer, without allocating.
+        /// </summary>
+        /// <param name="messageBytes">The bytes of a complete Harp message, including the checksum.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FrameAcquired> ReadTimestampedPayload(ReadOnlySpan<byte> messageBytes)
+        {
+            return Timestamped.Create(ReadPayload(messageBytes), PayloadReader.GetTimestamp(messageBytes));
+        }
+    }
+
+    public partial class Camera1Frame
+    {
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera1Frame"/> register messages
+        /// stored in a raw message buffer, without allocating.
+        /// </summary>
+        /// <param name="messageBytes">The bytes of a complete Harp message, including the checksum.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static FrameAcquired ReadPayload(ReadOnlySpan<byte> messageBytes)
+        {
+            return (FrameAcquired)PayloadReader.GetPayload(messageBytes)[0];
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera1Frame"/> register
+        /// messages stored in a raw message buffer, without allocating.
+        /// </summary>
+        /// <param name="messageBytes">The bytes of a complete Harp message, including the checksum.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FrameAcquired> ReadTimestampedPayload(ReadOnlySpan<byte> messageBytes)
+        {
+            return Timestamped.Create(ReadPayload(messageBytes), PayloadReader.GetTimestamp(messageBytes));
+        }
+    }
+}
@@ -0,0 +1,40 @@
+using Bonsai.Harp;
+using System;
+
+namespace Harp.Behavior
+{
+    public partial class RegisterTransaction
+    {
+        /// <summary>
+        /// Packs write messages of other registers into the payload of a single
+        /// <see cref="RegisterTransaction"/> write, to be applied in order.
+        /// </summary>
+        /// <param name="messages">The register write messages, e.g. created with the FromPayload method of each register.</param>
+        /// <returns>The payload of the <see cref="RegisterTransaction"/> register.</returns>
+        public static byte[] CreatePayload(params HarpMessage[] messages)
+        {
+            var payload = new byte[RegisterLength];
+            var offset = 0;
+            foreach (var message in messages)
+            {
+                if (message.Address == Address)
+                {
+                    throw new ArgumentException("A transaction cannot contain another transaction.", nameof(messages));
+                }
+
+                var data = PayloadReader.GetPayload(message.MessageBytes);
+                if (offset + 2 + data.Length > payload.Length)
+                {
+                    throw new ArgumentException($"The writes do not fit in the {RegisterLength} bytes of a transaction.", nameof(messages));
+                }
+
+                payload[offset++] = (byte)message.Address;
+                payload[offset++] = (byte)(message.PayloadType & ~PayloadType.Timestamp);
+                data.CopyTo(payload.AsSpan(offset));
+                offset += data.Length;
+            }
+
+            return payload;
+        }
+    }
+}